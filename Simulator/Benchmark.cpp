@@ -0,0 +1,617 @@
+/**
+*	File Name: Benchmark.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class Benchmark. Times the hot paths
+*		of the simulator (meta-data and config parsing, scheduling, memory allocation
+*		and logging) over generated inputs of increasing size
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Benchmark.h"
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include "Simulator.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+const char Benchmark::CONFIG_PATH[] = "bench.cfg";
+const char Benchmark::META_DATA_PATH[] = "bench.mdf";
+
+/**
+*	Function: Benchmark
+*	Description: Default constructor for Benchmark class
+*/
+Benchmark::Benchmark()
+{
+
+	seed = 1;
+	repeats = REPEATS;
+
+}
+
+/**
+*	Function: setRepeats
+*	Description: Sets how many times each benchmark is timed at each size, at least 
+*		once
+*/
+void Benchmark::setRepeats(int count)
+{
+
+	repeats = count > 0 ? count : 1;
+
+}
+
+/**
+*	Function: run
+*	Description: Runs every benchmark and stores the results in results. If quick is
+*		true the largest input size of each benchmark is skipped. Each round times 
+*		every benchmark once, so a stretch where the machine is slow is spread over 
+*		all of them rather than skewing one. Returns false if the generated 
+*		configuration could not be written.
+*/
+bool Benchmark::run(vector<BenchmarkResult>& results, bool quick)
+{
+
+	int instructions[] = {1000, 10000, 100000};
+	int lines[] = {10, 100, 1000};
+	int processes[] = {16, 128, 1024};
+	int sizeCount = quick ? 2 : 3;
+	vector<int> instructionSizes(instructions, instructions + sizeCount);
+	vector<int> lineSizes(lines, lines + sizeCount);
+	vector<int> processSizes(processes, processes + sizeCount);
+	
+	//every simulator is built from the same generated configuration
+	if (!writeFile(CONFIG_PATH, generateConfig(0)))
+	{
+		return 0;
+	}
+	ifstream fin(CONFIG_PATH);
+	configData.getConfigData(fin);
+	fin.close();
+	
+	results.clear();
+	times.clear();
+	for (int round = 0; round < repeats; round++)
+	{
+		nextResult = 0;
+		measure("parseMetaData", "instruction", &Benchmark::parseMetaData,
+				instructionSizes, results);
+		measure("getMetaData", "instruction", &Benchmark::getMetaData,
+				instructionSizes, results);
+		measure("getConfigData", "line", &Benchmark::getConfigData, lineSizes,
+				results);
+		measure("prioritySchedule", "process", &Benchmark::prioritySchedule,
+				processSizes, results);
+		measure("shortestJobFirstSchedule", "process",
+				&Benchmark::shortestJobFirstSchedule, processSizes, results);
+		measure("shortestTimeRemainingSchedule", "process",
+				&Benchmark::shortestTimeRemainingSchedule, processSizes, results);
+		measure("allocateMemory", "allocation", &Benchmark::allocateMemory,
+				instructionSizes, results);
+		measure("logEvents", "event", &Benchmark::logEvents, instructionSizes,
+				results);
+	}
+	for (int i = 0; i < results.size(); i++)
+	{
+		summarize(results[i], times[i]);
+	}
+	
+	remove(CONFIG_PATH);
+	remove(META_DATA_PATH);
+	
+	return 1;
+
+}
+
+/**
+*	Function: readResults
+*	Description: Reads results written by writeResults() from the file at path into
+*		results. Returns false if the file could not be opened.
+*/
+bool Benchmark::readResults(string path, vector<BenchmarkResult>& results)
+{
+
+	ifstream fin(path);
+	if (!fin.is_open())
+	{
+		return 0;
+	}
+	
+	string line;
+	getline(fin, line); //column names
+	while (getline(fin, line))
+	{
+		BenchmarkResult result;
+		string size, time, spread;
+		stringstream fields(line);
+		getline(fields, result.name, ',');
+		getline(fields, size, ',');
+		getline(fields, result.unit, ',');
+		getline(fields, time, ',');
+		getline(fields, spread, ','); //empty in results without a spread
+		if (!result.name.empty())
+		{
+			result.size = atoi(size.c_str());
+			result.nsPerOperation = atof(time.c_str());
+			result.spread = atof(spread.c_str());
+			results.push_back(result);
+		}
+	}
+	fin.close();
+	
+	return 1;
+
+}
+
+/**
+*	Function: writeResults
+*	Description: Writes results to the file at path as comma separated values, one
+*		benchmark and size per line. Returns false if the file could not be opened.
+*/
+bool Benchmark::writeResults(string path, vector<BenchmarkResult>& results)
+{
+
+	ofstream fout(path);
+	if (!fout.is_open())
+	{
+		return 0;
+	}
+	
+	char line[160];
+	fout << "benchmark,size,unit,ns_per_operation,spread_percent" << endl;
+	for (int i = 0; i < results.size(); i++)
+	{
+		snprintf(line, sizeof(line), "%s,%d,%s,%.2f,%.1f\n", results[i].name.c_str(),
+				 results[i].size, results[i].unit.c_str(), results[i].nsPerOperation,
+				 results[i].spread);
+		fout << line;
+	}
+	fout.close();
+	
+	return 1;
+
+}
+
+/**
+*	Function: compareResults
+*	Description: Writes every result next to the baseline result of the same benchmark
+*		and size to out. A result is only compared if its spread is within tolerance 
+*		percent, otherwise it is marked as unstable. A stable result is marked as a 
+*		regression if it is slower than its baseline by more than tolerance percent 
+*		and by more than the spreads of both, and as an improvement if it is faster 
+*		by as much. Returns the number of regressions.
+*/
+int Benchmark::compareResults(vector<BenchmarkResult>& results,
+							  vector<BenchmarkResult>& baseline, double tolerance,
+							  ostream& out)
+{
+
+	char line[160];
+	int regressions = 0;
+	
+	snprintf(line, sizeof(line), "%-30s %7s %-11s %12s %7s %12s %8s\n", "benchmark",
+			 "size", "unit", "ns/op", "spread", "baseline", "change");
+	out << line;
+	for (int i = 0; i < results.size(); i++)
+	{
+		BenchmarkResult& result = results[i];
+		snprintf(line, sizeof(line), "%-30s %7d %-11s %12.2f %6.1f%%",
+				 result.name.c_str(), result.size, result.unit.c_str(),
+				 result.nsPerOperation, result.spread);
+		out << line;
+	
+		int match = -1;
+		for (int j = 0; j < baseline.size(); j++)
+		{
+			if (baseline[j].name == result.name && baseline[j].size == result.size)
+			{
+				match = j;
+			}
+		}
+		if (match < 0 || baseline[match].nsPerOperation <= 0)
+		{
+			out << endl;
+			continue;
+		}
+	
+		double change = 100 * (result.nsPerOperation / baseline[match].nsPerOperation
+							   - 1);
+		double threshold = max(tolerance, result.spread + baseline[match].spread);
+		snprintf(line, sizeof(line), " %12.2f %+7.1f%%", baseline[match].nsPerOperation,
+				 change);
+		out << line;
+		if (result.spread > tolerance)
+		{
+			out << " unstable";
+		}
+		else if (change > threshold)
+		{
+			out << " regression";
+			regressions++;
+		}
+		else if (change < -threshold)
+		{
+			out << " improvement";
+		}
+		out << endl;
+	}
+	
+	return regressions;
+
+}
+
+/**
+*	Function: measure
+*	Description: Runs measurement once at each of sizes and keeps the times for the 
+*		results of benchmark name, timing operations of unit. The results are added 
+*		to results in the first round.
+*/
+void Benchmark::measure(string name, string unit, Measurement measurement,
+						vector<int> sizes, vector<BenchmarkResult>& results)
+{
+
+	for (int i = 0; i < sizes.size(); i++, nextResult++)
+	{
+		if (nextResult == results.size())
+		{
+			BenchmarkResult result;
+			result.name = name;
+			result.unit = unit;
+			result.size = sizes[i];
+			results.push_back(result);
+			times.push_back(vector<double>());
+		}
+	
+		//the same input is generated for every run of a size
+		seed = sizes[i];
+		times[nextResult].push_back((this->*measurement)(sizes[i]));
+	}
+
+}
+
+/**
+*	Function: summarize
+*	Description: Sets the time of result to the median of its timed runs in 
+*		runTimes and its spread to their interquartile range
+*/
+void Benchmark::summarize(BenchmarkResult& result, vector<double> runTimes)
+{
+
+	int count = runTimes.size();
+	sort(runTimes.begin(), runTimes.end());
+	result.nsPerOperation = (runTimes[(count - 1) / 2] + runTimes[count / 2]) / 2;
+	result.spread = result.nsPerOperation > 0 ?
+					100 * (runTimes[count * 3 / 4] - runTimes[count / 4]) / 
+					result.nsPerOperation : 0;
+
+}
+
+/**
+*	Function: parseMetaData
+*	Description: Times MetaData::parseMetaData() over size generated instructions
+*/
+double Benchmark::parseMetaData(int size)
+{
+
+	vector<string> instructions;
+	for (int i = 0; i < size; i++)
+	{
+		instructions.push_back(generateInstruction());
+	}
+	
+	long long start = Profiler::now();
+	for (int i = 0; i < size; i++)
+	{
+		MetaData instruction;
+		instruction.parseMetaData(instructions[i]);
+	}
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: getMetaData
+*	Description: Times Simulator::getMetaData() reading a meta-data file of size
+*		generated instructions, including opening the file
+*/
+double Benchmark::getMetaData(int size)
+{
+
+	if (!writeFile(META_DATA_PATH, generateMetaData(size)))
+	{
+		return 0;
+	}
+	Simulator simulator(configData);
+	deque<MetaData> instructionSet;
+	
+	long long start = Profiler::now();
+	ifstream fin(META_DATA_PATH);
+	simulator.getMetaData(fin, instructionSet);
+	fin.close();
+	return (Profiler::now() - start) / (double) instructionSet.size();
+
+}
+
+/**
+*	Function: getConfigData
+*	Description: Times Config::getConfigData() reading a configuration file with size
+*		optional setting lines, including opening the file
+*/
+double Benchmark::getConfigData(int size)
+{
+
+	string config = generateConfig(size);
+	if (!writeFile(CONFIG_PATH, config))
+	{
+		return 0;
+	}
+	int lineCount = 0;
+	for (int i = 0; i < config.size(); i++)
+	{
+		if (config[i] == '\n')
+		{
+			lineCount++;
+		}
+	}
+	Config parsed;
+	
+	long long start = Profiler::now();
+	ifstream fin(CONFIG_PATH);
+	parsed.getConfigData(fin);
+	fin.close();
+	return (Profiler::now() - start) / (double) lineCount;
+
+}
+
+/**
+*	Function: prioritySchedule
+*	Description: Times Simulator::prioritySchedule() on size generated processes
+*/
+double Benchmark::prioritySchedule(int size)
+{
+
+	deque<deque<MetaData>> processes = generateProcesses(size);
+	Simulator simulator(configData);
+	
+	long long start = Profiler::now();
+	simulator.prioritySchedule(processes);
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: shortestJobFirstSchedule
+*	Description: Times Simulator::shortestJobFirstSchedule() on size generated
+*		processes
+*/
+double Benchmark::shortestJobFirstSchedule(int size)
+{
+
+	deque<deque<MetaData>> processes = generateProcesses(size);
+	Simulator simulator(configData);
+	
+	long long start = Profiler::now();
+	simulator.shortestJobFirstSchedule(processes);
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: shortestTimeRemainingSchedule
+*	Description: Times Simulator::shortestTimeRemainingSchedule() reordering a ready
+*		queue of size generated processes with random estimated times remaining
+*/
+double Benchmark::shortestTimeRemainingSchedule(int size)
+{
+
+	deque<deque<MetaData>> processes = generateProcesses(size);
+	deque<int> indeces;
+	Simulator simulator(configData);
+	PCB pcb;
+	for (int i = 0; i < size; i++)
+	{
+		simulator.pcbContainer.add(pcb, nextRandom() % 100000 + 1);
+		indeces.push_back(i);
+	}
+	simulator.readyQueue = processes;
+	simulator.loadedProcessIndeces = indeces;
+	
+	long long start = Profiler::now();
+	simulator.shortestTimeRemainingSchedule(processes, indeces);
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: allocateMemory
+*	Description: Times size calls of Simulator::allocateMemory()
+*/
+double Benchmark::allocateMemory(int size)
+{
+
+	Simulator simulator(configData);
+	PCB pcb;
+	
+	long long start = Profiler::now();
+	for (int i = 0; i < size; i++)
+	{
+		simulator.allocateMemory(pcb);
+	}
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: logEvents
+*	Description: Times logging size events to a file through the writer thread of a
+*		Logger, including waiting for the writer to write all of them
+*/
+double Benchmark::logEvents(int size)
+{
+
+	Logger logger;
+	ofstream fout("/dev/null");
+	
+	long long start = Profiler::now();
+	if (!logger.start(1, &cout, &fout))
+	{
+		return 0;
+	}
+	for (int i = 0; i < size; i++)
+	{
+		logger.log(i / 1000.0, i % 2 ? EVENT_PROCESSING_END : EVENT_PROCESSING_START,
+				   i % 16 + 1);
+	}
+	logger.stop();
+	return (Profiler::now() - start) / (double) size;
+
+}
+
+/**
+*	Function: nextRandom
+*	Description: returns the next number of a linear congruential generator, so every
+*		run with the same seed generates the same input
+*/
+unsigned int Benchmark::nextRandom()
+{
+
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) & 0x7fff;
+
+}
+
+/**
+*	Function: generateInstruction
+*	Description: returns a random meta-data instruction ending in a semi-colon
+*/
+string Benchmark::generateInstruction()
+{
+
+	const char* operations[] = {"P{run}", "M{allocate}", "M{block}", "I{hard drive}",
+								"I{keyboard}", "I{scanner}", "O{hard drive}",
+								"O{monitor}", "O{projector}"};
+	char instruction[32];
+	snprintf(instruction, sizeof(instruction), "%s%u;", operations[nextRandom() % 9],
+			 nextRandom() % 20 + 1);
+	return instruction;
+
+}
+
+/**
+*	Function: generateMetaData
+*	Description: returns a meta-data file of size instructions, split into
+*		applications of up to 16 instructions
+*/
+string Benchmark::generateMetaData(int size)
+{
+
+	string text = "Start Program Meta-Data Code:\nS{begin}0; ";
+	int count = 1, applicationSize = 0;
+	while (count < size - 1)
+	{
+		if (applicationSize == 0 && count < size - 2)
+		{
+			text += "A{begin}0; ";
+			applicationSize = nextRandom() % 15 + 2;
+		}
+		else if (applicationSize == 1 || (applicationSize > 0 && count == size - 2))
+		{
+			text += "A{finish}0;\n";
+			applicationSize = 0;
+		}
+		else
+		{
+			text += generateInstruction() + " ";
+			if (applicationSize > 0)
+			{
+				applicationSize--;
+			}
+		}
+		count++;
+	}
+	text += "S{finish}0.\nEnd Program Meta-Data Code.\n";
+	return text;
+
+}
+
+/**
+*	Function: generateConfig
+*	Description: returns a configuration file that is followed by settingLines
+*		optional setting lines
+*/
+string Benchmark::generateConfig(int settingLines)
+{
+
+	string text = "Start Simulator Configuration File\n"
+				  "Version/Phase: 5.0\n"
+				  "File Path: bench.mdf\n"
+				  "Processor Quantum Number: 5\n"
+				  "CPU Scheduling Code: FIFO\n"
+				  "Processor cycle time {msec}: 5\n"
+				  "Monitor display time {msec}: 22\n"
+				  "Hard drive cycle time {msec}: 15\n"
+				  "Projector cycle time {msec}: 10\n"
+				  "Keyboard cycle time {msec}: 6\n"
+				  "Memory cycle time {msec}: 1\n"
+				  "Scanner cycle time {msec}: 3\n"
+				  "System memory {kbytes}: 2048\n"
+				  "Memory block size {kbytes}: 128\n"
+				  "Projector quantity: 4\n"
+				  "Hard drive quantity: 2\n"
+				  "Log: Log to File\n"
+				  "Log File Path: /dev/null\n";
+	for (int i = 0; i < settingLines; i++)
+	{
+		text += "Device sample interval {msec}: 0\n";
+	}
+	text += "End Simulator Configuration File\n";
+	return text;
+
+}
+
+/**
+*	Function: generateProcesses
+*	Description: returns size processes of 2 to 32 random instructions each
+*/
+deque<deque<MetaData>> Benchmark::generateProcesses(int size)
+{
+
+	deque<deque<MetaData>> processes(size);
+	for (int i = 0; i < size; i++)
+	{
+		int length = nextRandom() % 31 + 2;
+		for (int j = 0; j < length; j++)
+		{
+			MetaData instruction;
+			instruction.parseMetaData(generateInstruction());
+			processes[i].push_back(instruction);
+		}
+	}
+	return processes;
+
+}
+
+/**
+*	Function: writeFile
+*	Description: Writes text to the file at path. Returns false if the file could not
+*		be opened.
+*/
+bool Benchmark::writeFile(string path, string text)
+{
+
+	ofstream fout(path);
+	if (!fout.is_open())
+	{
+		cout << "ERROR: " << path << " could not be written" << endl;
+		return 0;
+	}
+	fout << text;
+	fout.close();
+	return 1;
+
+}
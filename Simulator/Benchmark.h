@@ -0,0 +1,90 @@
+/**
+*	File Name: Benchmark.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class Benchmark. Times the hot paths of the
+*		simulator (meta-data and config parsing, scheduling, memory allocation and
+*		logging) over generated inputs of increasing size
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef BENCHMARK_
+#define BENCHMARK_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <string>
+#include "Config.h"
+#include "MetaData.h"
+
+using namespace std;
+
+//time of one benchmark at one input size
+struct BenchmarkResult
+{
+	string name, unit; //unit is what a single operation is (instruction, line...)
+	int size;
+	double nsPerOperation; //median of the timed runs
+	double spread; //interquartile range of the timed runs, percent of the median
+};
+
+class Benchmark
+{
+
+	//Benchmark class public declarations
+	public:
+
+		Benchmark();
+
+		void setRepeats(int);
+		bool run(vector<BenchmarkResult>&, bool);
+
+		static bool readResults(string, vector<BenchmarkResult>&);
+		static bool writeResults(string, vector<BenchmarkResult>&);
+		static int compareResults(vector<BenchmarkResult>&, vector<BenchmarkResult>&,
+								  double, ostream&);
+
+		static const int REPEATS = 15; //timed runs of each size unless set otherwise
+
+	//Benchmark class private declarations
+	private:
+
+		//times one run at an input size, returns nanoseconds per operation
+		typedef double (Benchmark::*Measurement)(int);
+
+		void measure(string, string, Measurement, vector<int>,
+					 vector<BenchmarkResult>&);
+		void summarize(BenchmarkResult&, vector<double>);
+
+		double parseMetaData(int);
+		double getMetaData(int);
+		double getConfigData(int);
+		double prioritySchedule(int);
+		double shortestJobFirstSchedule(int);
+		double shortestTimeRemainingSchedule(int);
+		double allocateMemory(int);
+		double logEvents(int);
+
+		unsigned int nextRandom();
+		string generateInstruction();
+		string generateMetaData(int);
+		string generateConfig(int);
+		deque<deque<MetaData>> generateProcesses(int);
+		bool writeFile(string, string);
+
+		Config configData; //configuration every simulator is built from
+		unsigned int seed; //reset before every run so runs see the same input
+		int repeats;
+		vector<vector<double>> times; //nanoseconds per operation of each timed run
+		int nextResult; //result the next timed run belongs to
+
+		static const char CONFIG_PATH[];
+		static const char META_DATA_PATH[];
+
+};
+
+#endif
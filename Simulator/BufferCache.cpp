@@ -0,0 +1,468 @@
+/**
+*	File Name: BufferCache.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class BufferCache. A block cache in
+*		front of the hard drives: hits cost a memory cycle per block, writes are held
+*		back and flushed in batches, and sequential reads fetch the blocks that follow
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "BufferCache.h"
+#include <stdio.h>
+#include <limits.h>
+#include <algorithm>
+#include <vector>
+
+/**
+*	Function: BufferCache
+*	Description: Default constructor for BufferCache class, the cache starts disabled
+*/
+BufferCache::BufferCache()
+{
+
+	pthread_mutex_init(&mutexCache, NULL);
+	reset(Config());
+
+}
+
+/**
+*	Function: ~BufferCache
+*	Description: Destructor for BufferCache class
+*/
+BufferCache::~BufferCache()
+{
+
+	pthread_mutex_destroy(&mutexCache);
+
+}
+
+/**
+*	Function: reset
+*	Description: Empties the cache and forgets every measurement. The size, eviction
+*		policy, read ahead and flush threshold are taken from configData, a hit costs
+*		its memory cycle time per block.
+*/
+void BufferCache::reset(Config configData)
+{
+
+	pthread_mutex_lock(&mutexCache);
+	capacity = configData.getCacheSize();
+	policy = configData.getCachePolicyCode();
+	policyName = configData.getCachePolicyName();
+	readAhead = configData.getCacheReadAhead();
+	flushThreshold = configData.getCacheFlushThreshold();
+	memoryTime = configData.getMemoryTime();
+	
+	entries.clear();
+	recent.clear();
+	main.clear();
+	ghosts.clear();
+	ghostPositions.clear();
+	prefetchedBlocks.clear();
+	dirtyCount = 0;
+	reads = readHits = writes = writeHits = prefetched = prefetchHits = 0;
+	flushes = flushedBlocks = evictions = dirtyEvictions = 0;
+	pthread_mutex_unlock(&mutexCache);
+
+}
+
+/**
+*	Function: isEnabled
+*	Description: returns true if the cache holds any blocks
+*/
+bool BufferCache::isEnabled()
+{
+
+	return capacity > 0;
+
+}
+
+/**
+*	Function: read
+*	Description: Reads count blocks starting at block through the cache and stores
+*		the cost in result. Blocks in the cache are copied at memory speed, the ones
+*		that are not are read from the drive by one request. A read that misses right
+*		after a cached block also fetches the readAhead blocks that follow it.
+*/
+void BufferCache::read(int block, int count, CacheAccess& result)
+{
+
+	pthread_mutex_lock(&mutexCache);
+	result.hits = 0;
+	result.misses = 0;
+	result.diskBlock = -1;
+	result.diskBlocks = 0;
+	
+	//the block before still being cached means a stream is being read in order
+	bool sequential = entries.find(block - 1) != entries.end();
+	for (int i = block; i < block + count; i++)
+	{
+		if (access(i, false, result))
+		{
+			result.hits++;
+			if (prefetchedBlocks.erase(i))
+			{
+				prefetchHits++;
+			}
+		}
+		else
+		{
+			result.misses++;
+			addDiskBlocks(i, 1, result);
+		}
+	}
+	reads += count;
+	readHits += result.hits;
+	result.memoryTime = (long) result.hits * memoryTime;
+	
+	//the drive is reading anyway, so the blocks that follow come with the request
+	if (sequential && result.misses > 0)
+	{
+		for (int i = block + count; i < block + count + readAhead; i++)
+		{
+			if (entries.find(i) == entries.end())
+			{
+				access(i, false, result);
+				addDiskBlocks(i, 1, result);
+				prefetchedBlocks.insert(i);
+				prefetched++;
+			}
+		}
+	}
+	pthread_mutex_unlock(&mutexCache);
+
+}
+
+/**
+*	Function: write
+*	Description: Writes count blocks starting at block into the cache at memory speed
+*		and stores the cost in result. The blocks stay dirty until flushThreshold
+*		blocks are dirty, then all of them are written back by one drive request.
+*/
+void BufferCache::write(int block, int count, CacheAccess& result)
+{
+
+	pthread_mutex_lock(&mutexCache);
+	result.hits = 0;
+	result.misses = 0;
+	result.diskBlock = -1;
+	result.diskBlocks = 0;
+	
+	//whole blocks are written, so a miss does not read the block first
+	for (int i = block; i < block + count; i++)
+	{
+		if (access(i, true, result))
+		{
+			result.hits++;
+		}
+		else
+		{
+			result.misses++;
+		}
+	}
+	writes += count;
+	writeHits += result.hits;
+	result.memoryTime = (long) count * memoryTime;
+	
+	if (dirtyCount >= flushThreshold)
+	{
+		flush(result);
+	}
+	pthread_mutex_unlock(&mutexCache);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the hit rate of reads and writes, the blocks read ahead and
+*		how many of them were used, and the write backs of the cache to out. Writes
+*		nothing if the cache is disabled or was never used.
+*/
+void BufferCache::print(ostream& out)
+{
+
+	char line[160];
+	
+	pthread_mutex_lock(&mutexCache);
+	if (capacity <= 0 || reads + writes == 0)
+	{
+		pthread_mutex_unlock(&mutexCache);
+		return;
+	}
+	
+	out << endl << "Buffer Cache (" << policyName << ", " << capacity << " blocks)"
+		<< endl;
+	snprintf(line, sizeof(line), "%-10s %8s %8s %8s\n", "access", "blocks", "hits",
+			 "hit rate");
+	out << line;
+	snprintf(line, sizeof(line), "%-10s %8ld %8ld %7.1f%%\n", "read", reads, readHits,
+			 reads > 0 ? 100.0 * readHits / reads : 0.0);
+	out << line;
+	snprintf(line, sizeof(line), "%-10s %8ld %8ld %7.1f%%\n", "write", writes,
+			 writeHits, writes > 0 ? 100.0 * writeHits / writes : 0.0);
+	out << line;
+	snprintf(line, sizeof(line), "read ahead %ld blocks, %ld of them read\n",
+			 prefetched, prefetchHits);
+	out << line;
+	snprintf(line, sizeof(line), "flushes %ld (%ld blocks), evictions %ld (%ld dirty), "
+			 "dirty at end %d\n", flushes, flushedBlocks, evictions, dirtyEvictions,
+			 dirtyCount);
+	out << line;
+	pthread_mutex_unlock(&mutexCache);
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the blocks of each queue from the most recently used, with
+*		whether they are dirty, the blocks recently evicted, the blocks read ahead and
+*		the measurements to checkpoint
+*/
+void BufferCache::save(CheckpointWriter& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexCache);
+	checkpoint.putInt(capacity);
+	list<int>* queues[] = {&recent, &main, &ghosts};
+	for (int i = 0; i < 3; i++)
+	{
+		checkpoint.putInt(queues[i]->size());
+		list<int>::iterator it;
+		for (it = queues[i]->begin(); it != queues[i]->end(); it++)
+		{
+			checkpoint.putInt(*it);
+			if (queues[i] != &ghosts)
+			{
+				checkpoint.putInt(entries[*it].dirty);
+			}
+		}
+	}
+	
+	//sorted, so the same cache always gives the same checkpoint
+	vector<int> blocks(prefetchedBlocks.begin(), prefetchedBlocks.end());
+	sort(blocks.begin(), blocks.end());
+	checkpoint.putInt(blocks.size());
+	for (int i = 0; i < blocks.size(); i++)
+	{
+		checkpoint.putInt(blocks[i]);
+	}
+	
+	long counters[] = {reads, readHits, writes, writeHits, prefetched, prefetchHits,
+					   flushes, flushedBlocks, evictions, dirtyEvictions};
+	for (int i = 0; i < 10; i++)
+	{
+		checkpoint.putInt(counters[i]);
+	}
+	pthread_mutex_unlock(&mutexCache);
+
+}
+
+/**
+*	Function: restore
+*	Description: Reads the state written by save() from checkpoint into a cache reset
+*		with the same size. The policy, read ahead and flush threshold stay the ones it
+*		was reset with. Returns false if the checkpoint is not good or the size
+*		differs.
+*/
+bool BufferCache::restore(CheckpointReader& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexCache);
+	if (checkpoint.getInt(INT_MIN, INT_MAX) != capacity)
+	{
+		pthread_mutex_unlock(&mutexCache);
+		return 0;
+	}
+	
+	list<int>* queues[] = {&recent, &main, &ghosts};
+	for (int i = 0; checkpoint.isGood() && i < 3; i++)
+	{
+		for (long j = checkpoint.getInt(0, INT_MAX); checkpoint.isGood() && j > 0; j--)
+		{
+			int block = checkpoint.getInt(0, INT_MAX);
+			queues[i]->push_back(block);
+			if (queues[i] == &ghosts)
+			{
+				ghostPositions[block] = --ghosts.end();
+				continue;
+			}
+			CacheEntry& entry = entries[block];
+			entry.queue = i == 0 ? CACHE_RECENT : CACHE_MAIN;
+			entry.position = --queues[i]->end();
+			entry.dirty = checkpoint.getInt(0, 1);
+			dirtyCount += entry.dirty;
+		}
+	}
+	for (long i = checkpoint.getInt(0, INT_MAX); checkpoint.isGood() && i > 0; i--)
+	{
+		prefetchedBlocks.insert(checkpoint.getInt(0, INT_MAX));
+	}
+	
+	long* counters[] = {&reads, &readHits, &writes, &writeHits, &prefetched,
+						&prefetchHits, &flushes, &flushedBlocks, &evictions,
+						&dirtyEvictions};
+	for (int i = 0; i < 10; i++)
+	{
+		*counters[i] = checkpoint.getInt(0, LONG_MAX);
+	}
+	pthread_mutex_unlock(&mutexCache);
+	
+	return checkpoint.isGood();
+
+}
+
+/**
+*	Function: access
+*	Description: Looks block up and marks it dirty if write is true. A block that is
+*		not cached is added, evicting blocks while the cache is over capacity. 2Q
+*		keeps a new block in the recent queue and only promotes blocks seen again
+*		after they left it, so a single scan cannot flush the main queue. Returns
+*		true if block was cached.
+*/
+bool BufferCache::access(int block, bool write, CacheAccess& result)
+{
+
+	unordered_map<int, CacheEntry>::iterator found = entries.find(block);
+	if (found != entries.end())
+	{
+		CacheEntry& entry = found->second;
+		if (entry.queue == CACHE_MAIN)
+		{
+			main.splice(main.begin(), main, entry.position);
+		}
+		if (write && !entry.dirty)
+		{
+			entry.dirty = true;
+			dirtyCount++;
+		}
+		return true;
+	}
+	
+	CacheEntry entry;
+	entry.dirty = write;
+	unordered_map<int, list<int>::iterator>::iterator ghost;
+	ghost = ghostPositions.find(block);
+	if (policy == CACHE_LRU || ghost != ghostPositions.end())
+	{
+		if (ghost != ghostPositions.end())
+		{
+			ghosts.erase(ghost->second);
+			ghostPositions.erase(ghost);
+		}
+		main.push_front(block);
+		entry.queue = CACHE_MAIN;
+		entry.position = main.begin();
+	}
+	else
+	{
+		recent.push_front(block);
+		entry.queue = CACHE_RECENT;
+		entry.position = recent.begin();
+	}
+	entries[block] = entry;
+	if (write)
+	{
+		dirtyCount++;
+	}
+	
+	while (entries.size() > capacity)
+	{
+		evict(result);
+	}
+	return false;
+
+}
+
+/**
+*	Function: evict
+*	Description: Removes the least recently used block of main, or for 2Q the oldest
+*		block of recent while recent holds more than a quarter of the cache. A block
+*		leaving recent is remembered as a ghost, a dirty block is written back with
+*		the drive request of result.
+*/
+void BufferCache::evict(CacheAccess& result)
+{
+
+	int victim;
+	int recentLimit = capacity / 4 > 0 ? capacity / 4 : 1;
+	if (!recent.empty() && (recent.size() > recentLimit || main.empty()))
+	{
+		victim = recent.back();
+		recent.pop_back();
+		ghosts.push_front(victim);
+		ghostPositions[victim] = ghosts.begin();
+		if (ghosts.size() > capacity / 2)
+		{
+			ghostPositions.erase(ghosts.back());
+			ghosts.pop_back();
+		}
+	}
+	else
+	{
+		victim = main.back();
+		main.pop_back();
+	}
+	
+	if (entries[victim].dirty)
+	{
+		dirtyCount--;
+		dirtyEvictions++;
+		addDiskBlocks(victim, 1, result);
+	}
+	entries.erase(victim);
+	prefetchedBlocks.erase(victim);
+	evictions++;
+
+}
+
+/**
+*	Function: flush
+*	Description: Writes every dirty block back with the drive request of result and
+*		marks them clean
+*/
+void BufferCache::flush(CacheAccess& result)
+{
+
+	int lowest = -1, count = 0;
+	unordered_map<int, CacheEntry>::iterator it;
+	for (it = entries.begin(); it != entries.end(); it++)
+	{
+		if (it->second.dirty)
+		{
+			it->second.dirty = false;
+			if (lowest < 0 || it->first < lowest)
+			{
+				lowest = it->first;
+			}
+			count++;
+		}
+	}
+	if (count == 0)
+	{
+		return;
+	}
+	
+	addDiskBlocks(lowest, count, result);
+	dirtyCount = 0;
+	flushes++;
+	flushedBlocks += count;
+
+}
+
+/**
+*	Function: addDiskBlocks
+*	Description: Adds count blocks starting at block to the drive request of result.
+*		The request starts at the lowest block it holds.
+*/
+void BufferCache::addDiskBlocks(int block, int count, CacheAccess& result)
+{
+
+	if (result.diskBlocks == 0 || block < result.diskBlock)
+	{
+		result.diskBlock = block;
+	}
+	result.diskBlocks += count;
+
+}
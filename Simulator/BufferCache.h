@@ -0,0 +1,90 @@
+/**
+*	File Name: BufferCache.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class BufferCache. A block cache in front of
+*		the hard drives: hits cost a memory cycle per block, writes are held back and
+*		flushed in batches, and sequential reads fetch the blocks that follow
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef BUFFER_CACHE_
+#define BUFFER_CACHE_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <pthread.h>
+#include "Config.h"
+#include "Checkpoint.h"
+
+using namespace std;
+
+//what an access cost and the hard drive request it needs, if any
+struct CacheAccess
+{
+	int hits, misses;
+	long memoryTime; //msec spent copying blocks to or from the cache
+	int diskBlock, diskBlocks; //first block and number of blocks for the drive
+};
+
+class BufferCache
+{
+
+	//BufferCache class public declarations
+	public:
+	
+		BufferCache();
+		~BufferCache();
+	
+		void reset(Config);
+		bool isEnabled();
+		void read(int, int, CacheAccess&);
+		void write(int, int, CacheAccess&);
+		void print(ostream&);
+		void save(CheckpointWriter&);
+		bool restore(CheckpointReader&);
+	
+	//BufferCache class private declarations
+	private:
+	
+		//queues of 2Q, LRU keeps every block in CACHE_MAIN
+		enum CacheQueue
+		{
+			CACHE_RECENT, CACHE_MAIN
+		};
+	
+		struct CacheEntry
+		{
+			int queue; //CacheQueue
+			list<int>::iterator position;
+			bool dirty;
+		};
+	
+		bool access(int, bool, CacheAccess&);
+		void evict(CacheAccess&);
+		void flush(CacheAccess&);
+		void addDiskBlocks(int, int, CacheAccess&);
+	
+		int capacity, policy, readAhead, flushThreshold, memoryTime;
+		string policyName;
+		unordered_map<int, CacheEntry> entries;
+		list<int> recent, main; //front is the most recently used block
+		list<int> ghosts; //blocks recently evicted from recent, for 2Q
+		unordered_map<int, list<int>::iterator> ghostPositions;
+		int dirtyCount;
+	
+		long reads, readHits, writes, writeHits, prefetched, prefetchHits;
+		long flushes, flushedBlocks, evictions, dirtyEvictions;
+		unordered_set<int> prefetchedBlocks; //read ahead and not read since
+	
+		pthread_mutex_t mutexCache;
+	
+};
+
+#endif
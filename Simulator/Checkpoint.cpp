@@ -0,0 +1,183 @@
+/**
+*	File Name: Checkpoint.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the classes CheckpointWriter and
+*		CheckpointReader. Write and read the state of a simulation as a compact
+*		binary checkpoint: a versioned header followed by variable length integers
+*		and fixed size doubles
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Checkpoint.h"
+#include <stdio.h>
+#include <string.h>
+
+const char CheckpointWriter::CHECKPOINT_MAGIC[8] = {'S', 'I', 'M', 'C', 'K', 'P', 'N',
+													'T'};
+
+/**
+*	Function: CheckpointWriter
+*	Description: Parameterized constructor for CheckpointWriter class, writes the
+*		header of the checkpoint to outSource
+*/
+CheckpointWriter::CheckpointWriter(ostream& outSource) : out(outSource)
+{
+
+	out.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+	putInt(CHECKPOINT_VERSION);
+
+}
+
+/**
+*	Function: putInt
+*	Description: Writes value in as few bytes as it needs: zigzag encoded so small
+*		negative values stay small, then seven bits per byte, lowest first, with the
+*		high bit set on every byte but the last
+*/
+void CheckpointWriter::putInt(long long value)
+{
+
+	unsigned long long bits = ((unsigned long long) value << 1) ^ (value < 0 ? ~0ULL :
+							  0ULL);
+	while (bits >= 0x80)
+	{
+		out.put((char) ((bits & 0x7f) | 0x80));
+		bits >>= 7;
+	}
+	out.put((char) bits);
+
+}
+
+/**
+*	Function: putDouble
+*	Description: Writes value as its 8 bytes in little endian order, so it is read
+*		back exactly
+*/
+void CheckpointWriter::putDouble(double value)
+{
+
+	unsigned long long bits;
+	memcpy(&bits, &value, sizeof(bits));
+	for (int i = 0; i < 8; i++)
+	{
+		out.put((char) (bits >> (8 * i)));
+	}
+
+}
+
+/**
+*	Function: isGood
+*	Description: returns true if everything was written
+*/
+bool CheckpointWriter::isGood()
+{
+
+	return out.good();
+
+}
+
+/**
+*	Function: CheckpointReader
+*	Description: Parameterized constructor for CheckpointReader class, reads and
+*		checks the header of the checkpoint in inSource. Checkpoints of another
+*		version are not read.
+*/
+CheckpointReader::CheckpointReader(istream& inSource) : in(inSource)
+{
+
+	char magic[sizeof(CheckpointWriter::CHECKPOINT_MAGIC)];
+	in.read(magic, sizeof(magic));
+	good = in.gcount() == sizeof(magic) &&
+		   memcmp(magic, CheckpointWriter::CHECKPOINT_MAGIC, sizeof(magic)) == 0;
+	if (good && getInt(0, 255) != CheckpointWriter::CHECKPOINT_VERSION)
+	{
+		good = false;
+	}
+
+}
+
+/**
+*	Function: getInt
+*	Description: returns the next integer (see putInt), which has to be from low to
+*		high. Returns low and reads nothing more once the checkpoint is not good.
+*/
+long long CheckpointReader::getInt(long long low, long long high)
+{
+
+	unsigned long long bits = 0;
+	int byte = 0x80;
+	for (int shift = 0; good && (byte & 0x80); shift += 7)
+	{
+		byte = in.get();
+		if (byte == EOF || shift > 63)
+		{
+			good = false;
+			return low;
+		}
+		bits |= (unsigned long long) (byte & 0x7f) << shift;
+	}
+	
+	long long value = (long long) (bits >> 1) ^ -(long long) (bits & 1);
+	if (!good || value < low || value > high)
+	{
+		good = false;
+		return low;
+	}
+	return value;
+
+}
+
+/**
+*	Function: getCount
+*	Description: returns the next number of entries of a saved list, which may be at
+*		most MAX_COUNT, so a corrupt checkpoint cannot make the reader allocate room 
+*		for more entries than it could hold. Returns 0 once the checkpoint is not good.
+*/
+long long CheckpointReader::getCount()
+{
+
+	return getInt(0, MAX_COUNT);
+
+}
+
+/**
+*	Function: getDouble
+*	Description: returns the next double (see putDouble), 0 once the checkpoint is not
+*		good
+*/
+double CheckpointReader::getDouble()
+{
+
+	unsigned long long bits = 0;
+	for (int i = 0; good && i < 8; i++)
+	{
+		int byte = in.get();
+		if (byte == EOF)
+		{
+			good = false;
+		}
+		bits |= (unsigned long long) (byte & 0xff) << (8 * i);
+	}
+	if (!good)
+	{
+		return 0;
+	}
+	
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+
+}
+
+/**
+*	Function: isGood
+*	Description: returns true if the header and every value read so far were right
+*/
+bool CheckpointReader::isGood()
+{
+
+	return good;
+
+}
@@ -0,0 +1,70 @@
+/**
+*	File Name: Checkpoint.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the classes CheckpointWriter and
+*		CheckpointReader. Write and read the state of a simulation as a compact
+*		binary checkpoint: a versioned header followed by variable length integers
+*		and fixed size doubles
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef CHECKPOINT_
+#define CHECKPOINT_
+
+//library inclusion and directives
+
+#include <iostream>
+
+using namespace std;
+
+class CheckpointWriter
+{
+
+	//CheckpointWriter class public declarations
+	public:
+	
+		CheckpointWriter(ostream&);
+	
+		void putInt(long long);
+		void putDouble(double);
+		bool isGood();
+	
+		//checkpoints start with CHECKPOINT_MAGIC followed by CHECKPOINT_VERSION,
+		//which changes whenever what is saved changes
+		static const char CHECKPOINT_MAGIC[8];
+		static const int CHECKPOINT_VERSION = 1;
+	
+	//CheckpointWriter class private declarations
+	private:
+	
+		ostream& out;
+	
+};
+
+class CheckpointReader
+{
+
+	//CheckpointReader class public declarations
+	public:
+	
+		CheckpointReader(istream&);
+	
+		long long getInt(long long, long long);
+		long long getCount();
+		double getDouble();
+		bool isGood();
+	
+		//most entries a saved list may hold, far more than any simulation queues
+		static const long long MAX_COUNT = 1000000;
+	
+	//CheckpointReader class private declarations
+	private:
+	
+		istream& in;
+		bool good; //false once the header or a value was wrong or the input ended
+	
+};
+
+#endif
@@ -0,0 +1,286 @@
+/**
+*	File Name: ChromeTrace.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class ChromeTrace. Turns the logged
+*		events of a simulation into Chrome Trace Event JSON, with a timeline track for
+*		the processor, memory, each device unit and each process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "ChromeTrace.h"
+#include <stdio.h>
+
+//track keys, in the order the tracks are shown. A unit of a device gets 
+//TRACK_DEVICE * (device + 1) + unit, so any number of units fits, and a process gets 
+//TRACK_PROCESS + pid. write() numbers the tracks in this order for their trace ids.
+static const long long TRACK_PROCESSOR = 1;
+static const long long TRACK_MEMORY = 2;
+static const long long TRACK_DEVICE = 1LL << 32;
+static const long long TRACK_PROCESS = TRACK_DEVICE * (DEVICE_COUNT + 1);
+
+/**
+*	Function: ChromeTrace
+*	Description: Default constructor for ChromeTrace class
+*/
+ChromeTrace::ChromeTrace()
+{
+
+	lastTimestamp = 0;
+	trackNames[TRACK_PROCESSOR] = "Processor";
+	trackNames[TRACK_MEMORY] = "Memory";
+
+}
+
+/**
+*	Function: addEvent
+*	Description: Adds a logged event to the timeline. Start events open an action on
+*		the track of the processor, memory, device unit or process it uses and the
+*		matching end event closes it. I/O end events carry the unit of their start 
+*		event, so they close the oldest action of the process on that unit.
+*/
+void ChromeTrace::addEvent(const LogEvent& event)
+{
+
+	char name[64];
+	long long processTrack = TRACK_PROCESS + event.pid;
+	
+	if (event.timestamp > lastTimestamp)
+	{
+		lastTimestamp = event.timestamp;
+	}
+	
+	switch (event.type)
+	{
+		case EVENT_SIMULATOR_START:
+			addInstant(event, TRACK_PROCESSOR, "Simulator program starting");
+		break;
+		case EVENT_SIMULATOR_END:
+			addInstant(event, TRACK_PROCESSOR, "Simulator program ending");
+		break;
+		case EVENT_PROCESS_ARRIVE:
+			addInstant(event, processTrack, "arrival");
+		break;
+		case EVENT_PROCESS_PREPARE:
+			addInstant(event, processTrack, "preparing process");
+		break;
+		case EVENT_PROCESS_START:
+			snprintf(name, sizeof(name), "Process %d", event.pid);
+			openSlice(event, SLICE_PROCESS, processTrack, name);
+		break;
+		case EVENT_PROCESS_END:
+			closeSlice(event.timestamp, event.pid, SLICE_PROCESS, processTrack);
+		break;
+		case EVENT_PROCESSING_START:
+			snprintf(name, sizeof(name), "Process %d", event.pid);
+			openSlice(event, SLICE_PROCESSING, TRACK_PROCESSOR, name);
+		break;
+		case EVENT_PROCESSING_RESUME:
+			snprintf(name, sizeof(name), "Process %d (resumed)", event.pid);
+			openSlice(event, SLICE_PROCESSING, TRACK_PROCESSOR, name);
+		break;
+		case EVENT_PROCESSING_END:
+			closeSlice(event.timestamp, event.pid, SLICE_PROCESSING, TRACK_PROCESSOR);
+		break;
+		case EVENT_PROCESSING_INTERRUPT:
+			closeSlice(event.timestamp, event.pid, SLICE_PROCESSING, TRACK_PROCESSOR,
+					   ",\"interrupted\":true");
+			addInstant(event, TRACK_PROCESSOR, "interrupt");
+		break;
+		case EVENT_MEMORY_ALLOCATE_START:
+			openSlice(event, SLICE_MEMORY, TRACK_MEMORY, "allocate");
+		break;
+		case EVENT_MEMORY_ALLOCATE_END:
+			snprintf(name, sizeof(name), ",\"address\":\"0x%08x\"", event.address);
+			closeSlice(event.timestamp, event.pid, SLICE_MEMORY, TRACK_MEMORY, name);
+		break;
+		case EVENT_MEMORY_BLOCK_START:
+			openSlice(event, SLICE_MEMORY, TRACK_MEMORY, "block");
+		break;
+		case EVENT_MEMORY_BLOCK_END:
+			closeSlice(event.timestamp, event.pid, SLICE_MEMORY, TRACK_MEMORY);
+		break;
+		case EVENT_INPUT_START:
+		case EVENT_OUTPUT_START:
+			snprintf(name, sizeof(name), "Process %d %s", event.pid,
+					 event.type == EVENT_INPUT_START ? "input" : "output");
+			openSlice(event, SLICE_IO, getTrack(event.device, event.unit), name);
+		break;
+		case EVENT_INPUT_END:
+		case EVENT_OUTPUT_END:
+			closeSlice(event.timestamp, event.pid, SLICE_IO, 
+					   getTrack(event.device, event.unit));
+		break;
+	}
+
+}
+
+/**
+*	Function: write
+*	Description: Ends every action still open at the time of the last event, then
+*		writes the whole trace to out as a Chrome Trace Event JSON object. The tracks
+*		are numbered by their keys, so the processor and memory come first, followed
+*		by the units of each device, as many as the trace used, and the processes.
+*/
+void ChromeTrace::write(ostream& out)
+{
+
+	char entry[256];
+	map<long long, int> trackIds;
+	int trackId = 1;
+	
+	while (!openSlices.empty())
+	{
+		SliceKey key = openSlices.begin()->first;
+		closeSlice(lastTimestamp, key.first / SLICE_KIND_COUNT, 
+				   key.first % SLICE_KIND_COUNT, key.second, ",\"unfinished\":true");
+	}
+	
+	out << "{\"traceEvents\":[" << endl;
+	out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+		<< "\"args\":{\"name\":\"Simulator\"}}";
+	for (map<long long, string>::iterator it = trackNames.begin(); 
+		 it != trackNames.end(); it++, trackId++)
+	{
+		trackIds[it->first] = trackId;
+		snprintf(entry, sizeof(entry), ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+				 "\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", trackId,
+				 it->second.c_str());
+		out << entry;
+		snprintf(entry, sizeof(entry), ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\","
+				 "\"pid\":1,\"tid\":%d,\"args\":{\"sort_index\":%d}}", trackId,
+				 trackId);
+		out << entry;
+	}
+	for (int i = 0; i < entries.size(); i++)
+	{
+		out << "," << endl << entries[i].json << ",\"tid\":" 
+			<< trackIds[entries[i].track] << "}";
+	}
+	out << endl << "],\"displayTimeUnit\":\"ms\"}" << endl;
+
+}
+
+/**
+*	Function: openSlice
+*	Description: Starts an action of kind for the process of event on track
+*/
+void ChromeTrace::openSlice(const LogEvent& event, int kind, long long track, 
+							string name)
+{
+
+	OpenSlice slice;
+	slice.start = event.timestamp;
+	slice.name = name;
+	openSlices.insert(make_pair(SliceKey(event.pid * SLICE_KIND_COUNT + kind, track),
+								slice));
+	if (trackNames.find(track) == trackNames.end())
+	{
+		trackNames[track] = getTrackName(track);
+	}
+
+}
+
+/**
+*	Function: closeSlice
+*	Description: Ends the oldest open action of kind for process pid on track at 
+*		timestamp and adds it to the trace as a complete event. args holds extra JSON 
+*		members for the event's arguments, starting with a comma. Does nothing if no 
+*		such action is open.
+*/
+void ChromeTrace::closeSlice(double timestamp, int pid, int kind, long long track, 
+							 string args)
+{
+
+	char entry[256];
+	multimap<SliceKey, OpenSlice>::iterator it = 
+		openSlices.find(SliceKey(pid * SLICE_KIND_COUNT + kind, track));
+	
+	if (it == openSlices.end())
+	{
+		return;
+	}
+	
+	OpenSlice& slice = it->second;
+	snprintf(entry, sizeof(entry), "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+			 "\"dur\":%.3f,\"pid\":1,\"args\":{\"pid\":%d%s}", slice.name.c_str(), 
+			 slice.start * 1000000, (timestamp - slice.start) * 1000000, pid, 
+			 args.c_str());
+	TraceEntry finished = {track, entry};
+	entries.push_back(finished);
+	openSlices.erase(it);
+
+}
+
+/**
+*	Function: addInstant
+*	Description: Adds a point in time marker called name to track at the time of event
+*/
+void ChromeTrace::addInstant(const LogEvent& event, long long track, string name)
+{
+
+	char entry[256];
+	
+	snprintf(entry, sizeof(entry), "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\","
+			 "\"ts\":%.3f,\"pid\":1,\"args\":{\"pid\":%d}", name.c_str(),
+			 event.timestamp * 1000000, event.pid);
+	TraceEntry instant = {track, entry};
+	entries.push_back(instant);
+	if (trackNames.find(track) == trackNames.end())
+	{
+		trackNames[track] = getTrackName(track);
+	}
+
+}
+
+/**
+*	Function: getTrack
+*	Description: returns the track key of the unit of device. Devices without units
+*		(unit -1) use unit 0.
+*/
+long long ChromeTrace::getTrack(int device, int unit)
+{
+
+	if (unit < 0)
+	{
+		unit = 0;
+	}
+	return TRACK_DEVICE * (device + 1) + unit;
+
+}
+
+/**
+*	Function: getTrackName
+*	Description: returns the name shown for the track with key track
+*/
+string ChromeTrace::getTrackName(long long track)
+{
+
+	char name[64];
+	
+	if (track >= TRACK_PROCESS)
+	{
+		snprintf(name, sizeof(name), "Process %d", (int) (track - TRACK_PROCESS));
+	}
+	else if (track >= TRACK_DEVICE)
+	{
+		int device = (int) (track / TRACK_DEVICE) - 1;
+		int unit = (int) (track % TRACK_DEVICE);
+		if (device == DEVICE_HARD_DRIVE || device == DEVICE_PROJECTOR)
+		{
+			snprintf(name, sizeof(name), "%s %d", Logger::getDeviceName(device), unit);
+		}
+		else
+		{
+			snprintf(name, sizeof(name), "%s", Logger::getDeviceName(device));
+		}
+	}
+	else
+	{
+		return trackNames[track];
+	}
+	
+	return name;
+
+}
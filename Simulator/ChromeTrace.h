@@ -0,0 +1,76 @@
+/**
+*	File Name: ChromeTrace.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class ChromeTrace. Turns the logged events of
+*		a simulation into Chrome Trace Event JSON, with a timeline track for the
+*		processor, memory, each device unit and each process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef CHROME_TRACE_
+#define CHROME_TRACE_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include "Logger.h"
+
+using namespace std;
+
+class ChromeTrace : public EventSink
+{
+
+	//ChromeTrace class public declarations
+	public:
+
+		ChromeTrace();
+
+		void addEvent(const LogEvent&);
+		void write(ostream&);
+
+	//ChromeTrace class private declarations
+	private:
+
+		//an action that has started but not yet ended
+		struct OpenSlice
+		{
+			double start;
+			string name;
+		};
+		
+		//a finished trace event in JSON, without its track id and closing brace, 
+		//which write() adds once every track is known
+		struct TraceEntry
+		{
+			long long track;
+			string json;
+		};
+		
+		//pid * SLICE_KIND_COUNT + SliceKind, and the track of the action
+		typedef pair<int, long long> SliceKey;
+
+		//kinds of actions a process can have running at once
+		enum SliceKind
+		{
+			SLICE_PROCESS, SLICE_PROCESSING, SLICE_MEMORY, SLICE_IO, SLICE_KIND_COUNT
+		};
+
+		void openSlice(const LogEvent&, int, long long, string);
+		void closeSlice(double, int, int, long long, string = "");
+		void addInstant(const LogEvent&, long long, string);
+		long long getTrack(int, int);
+		string getTrackName(long long);
+
+		multimap<SliceKey, OpenSlice> openSlices; //oldest first for equal keys
+		map<long long, string> trackNames;
+		vector<TraceEntry> entries;
+		double lastTimestamp;
+
+};
+
+#endif
@@ -9,6 +9,7 @@
 */
 
 #include "Config.h"
+#include <stdlib.h>
 
 /**
 *	Function: Config
@@ -17,6 +18,36 @@
 Config::Config()
 {
 
+	deviceSampleInterval = 0;
+	keyboardQuant = 1;
+	scannerQuant = 1;
+	monitorQuant = 1;
+	diskScheduleCode = DISK_FCFS;
+	diskTracks = 1000;
+	diskBlocksPerTrack = 100;
+	diskTrackSeekTime = 0;
+	diskRotationTime = 0;
+	diskDeadline = 500;
+	diskBatchSize = 1;
+	diskBatchWindow = 0;
+	dispatchPolicyCode = DISPATCH_SHORTEST_QUEUE;
+	cacheSize = 0;
+	cachePolicyCode = CACHE_LRU;
+	cacheReadAhead = 0;
+	cacheFlushThreshold = 16;
+	interruptHandlerTime = 0;
+	interruptCoalesceCount = 1;
+	interruptCoalesceTime = 0;
+	randomSeed = 1;
+	decisionLogMode = DECISIONS_OFF;
+	decisionLogPath = "decisions.dlg";
+	//off unless asked for: an analytic run sleeps for none of the operations and 
+	//leaves out every report measured on the threads, which a simulated run exists 
+	//to produce
+	analyticFastPath = false;
+	timeScale = 1;
+	timerWaitMode = TIMER_HYBRID;
+
 }
 
 /**
@@ -131,27 +162,8 @@ void Config::getConfigData(ifstream& fin)
 	}
 	word.clear();
 	fin >> word;
-	if (word == "FIFO")
-	{
-		cpuScheduleCode = 0;
-	}
-	else if (word == "PS")
-	{
-		cpuScheduleCode = 1;
-	}
-	else if (word == "SJF")
-	{
-		cpuScheduleCode = 2;
-	}
-	else if (word == "STR")
-	{
-		cpuScheduleCode = 3;
-	}
-	else if (word == "RR")
-	{
-		cpuScheduleCode = 4;
-	}
-	else
+	cpuScheduleCode = parseCpuScheduleCode(word);
+	if (cpuScheduleCode < 0)
 	{
 		cout << "ERROR: invalid code on line 5" << endl;
 		return;
@@ -439,6 +451,10 @@ void Config::getConfigData(ifstream& fin)
 	{
 		logType = 2;
 	}
+	else if (line == "Log: Log to Binary")
+	{
+		logType = 3;
+	}
 	else
 	{
 		cout << "ERROR: Typo on line 17" << endl;
@@ -469,12 +485,27 @@ void Config::getConfigData(ifstream& fin)
 	word.clear();
 	fin >> logPath;
 	
-	//line 19 error check
+	//optional settings, one "key: value" per line, followed by the line 19 check
 	getline(fin, line); //eliminating rest of current line
 	getline(fin, line);
+	int lineNumber = 19;
+	while (fin && line != "End Simulator Configuration File")
+	{
+		size_t colon = line.find(": ");
+		if (colon == string::npos || 
+			!applySetting(line.substr(0, colon), line.substr(colon + 2)))
+		{
+			cout << "ERROR: Unknown setting or invalid value on line " << lineNumber 
+				 << endl;
+			return;
+		}
+		line.clear();
+		getline(fin, line);
+		lineNumber++;
+	}
 	if (line != "End Simulator Configuration File")
 	{
-		cout << "ERROR: Typo on line 19" << endl;
+		cout << "ERROR: Typo on line " << lineNumber << endl;
 		return;
 	}
 	line.clear();
@@ -618,6 +649,474 @@ int Config::getComponentTime(char code, string descriptor)
 	
 }
 
+/**
+*	Function: getDeviceTimeTable
+*	Description: Fills the parameter table with the cycle time of every device, indexed 
+*		by DeviceId. Instructions that do not use a device (DEVICE_NONE) take no time. 
+*		Used to calculate the total times of many instructions at once without looking 
+*		up each device by name.
+*/
+void Config::getDeviceTimeTable(int table[DEVICE_COUNT])
+{
+
+	table[DEVICE_NONE] = 0;
+	table[DEVICE_PROCESSOR] = processorTime;
+	table[DEVICE_MEMORY] = memoryTime;
+	table[DEVICE_HARD_DRIVE] = hardDriveTime;
+	table[DEVICE_KEYBOARD] = keyboardTime;
+	table[DEVICE_SCANNER] = scannerTime;
+	table[DEVICE_MONITOR] = monitorTime;
+	table[DEVICE_PROJECTOR] = projectorTime;
+
+}
+
+/**
+*	Function: applySetting
+*	Description: Sets a single configuration value after the configuration file has 
+*		been read. The parameter key is the name of the setting as it is written in the 
+*		configuration file, without the colon (e.g. "Hard drive cycle time {msec}"), 
+*		and value is the new value as text. Used to derive variations of a 
+*		configuration. Returns true if the setting was applied, returns false if the 
+*		key is unknown or the value is invalid.
+*/
+bool Config::applySetting(string key, string value)
+{
+
+	int number;
+	
+	if (key == "CPU Scheduling Code")
+	{
+		number = parseCpuScheduleCode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		cpuScheduleCode = number;
+		return 1;
+	}
+	else if (key == "Device sample interval {msec}")
+	{
+		//0 turns sampling off
+		if (value == "0")
+		{
+			deviceSampleInterval = 0;
+			return 1;
+		}
+		if (!parsePositiveInt(value, number))
+		{
+			return 0;
+		}
+		deviceSampleInterval = number;
+		return 1;
+	}
+	else if (key == "Disk scheduling algorithm")
+	{
+		number = parseDiskScheduleCode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		diskScheduleCode = number;
+		return 1;
+	}
+	else if (key == "Device dispatch policy")
+	{
+		number = parseDispatchPolicyCode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		dispatchPolicyCode = number;
+		return 1;
+	}
+	else if (key == "Buffer cache policy")
+	{
+		number = parseCachePolicyCode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		cachePolicyCode = number;
+		return 1;
+	}
+	else if (key == "Decision log")
+	{
+		number = parseDecisionLogMode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		decisionLogMode = number;
+		return 1;
+	}
+	else if (key == "Decision log file path")
+	{
+		if (value.empty())
+		{
+			return 0;
+		}
+		decisionLogPath = value;
+		return 1;
+	}
+	else if (key == "Analytic fast path" && (value == "On" || value == "Off"))
+	{
+		analyticFastPath = value == "On";
+		return 1;
+	}
+	else if (key == "Timer wait")
+	{
+		number = parseTimerWaitMode(value);
+		if (number < 0)
+		{
+			return 0;
+		}
+		timerWaitMode = number;
+		return 1;
+	}
+	else if (key == "Time scale")
+	{
+		//0.01 runs the program 100 times faster, timestamps stay in simulated time. 
+		//The real time of thread creation and timer wake-ups is not scaled, so a 
+		//run refuses a scale that leaves an operation less real time than that, 
+		//see Simulator::checkTimeScale()
+		char* end;
+		double scale = strtod(value.c_str(), &end);
+		if (value.empty() || *end != '\0' || !(scale > 0))
+		{
+			return 0;
+		}
+		timeScale = scale;
+		return 1;
+	}
+	else if (key == "Random seed" && value == "Time")
+	{
+		//seeded from the clock, so runs no longer repeat
+		randomSeed = 0;
+		return 1;
+	}
+	else if (key == "Buffer cache size {blocks}" && value == "0")
+	{
+		cacheSize = 0;
+		return 1;
+	}
+	else if (key == "Buffer cache read ahead {blocks}" && value == "0")
+	{
+		cacheReadAhead = 0;
+		return 1;
+	}
+	else if (key == "Disk track seek time {usec}" && value == "0")
+	{
+		diskTrackSeekTime = 0;
+		return 1;
+	}
+	else if (key == "Disk rotation time {msec}" && value == "0")
+	{
+		diskRotationTime = 0;
+		return 1;
+	}
+	else if (key == "Disk batch window {msec}" && value == "0")
+	{
+		diskBatchWindow = 0;
+		return 1;
+	}
+	else if (key == "Interrupt handler time {msec}" && value == "0")
+	{
+		interruptHandlerTime = 0;
+		return 1;
+	}
+	else if (key == "Interrupt coalescing time {msec}" && value == "0")
+	{
+		interruptCoalesceTime = 0;
+		return 1;
+	}
+	
+	//every other setting is a positive whole number
+	if (!parsePositiveInt(value, number))
+	{
+		return 0;
+	}
+	
+	if (key == "Processor Quantum Number")
+	{
+		processorQuantumNumber = number;
+	}
+	else if (key == "Monitor display time {msec}")
+	{
+		monitorTime = number;
+	}
+	else if (key == "Processor cycle time {msec}")
+	{
+		processorTime = number;
+	}
+	else if (key == "Scanner cycle time {msec}")
+	{
+		scannerTime = number;
+	}
+	else if (key == "Hard drive cycle time {msec}")
+	{
+		hardDriveTime = number;
+	}
+	else if (key == "Keyboard cycle time {msec}")
+	{
+		keyboardTime = number;
+	}
+	else if (key == "Memory cycle time {msec}")
+	{
+		memoryTime = number;
+	}
+	else if (key == "Projector cycle time {msec}")
+	{
+		projectorTime = number;
+	}
+	else if (key == "Projector quantity")
+	{
+		projQuant = number;
+	}
+	else if (key == "Hard drive quantity")
+	{
+		hddQuant = number;
+	}
+	else if (key == "Keyboard quantity")
+	{
+		keyboardQuant = number;
+	}
+	else if (key == "Scanner quantity")
+	{
+		scannerQuant = number;
+	}
+	else if (key == "Monitor quantity")
+	{
+		monitorQuant = number;
+	}
+	else if (key == "Disk tracks")
+	{
+		diskTracks = number;
+	}
+	else if (key == "Disk blocks per track")
+	{
+		diskBlocksPerTrack = number;
+	}
+	else if (key == "Disk track seek time {usec}")
+	{
+		diskTrackSeekTime = number;
+	}
+	else if (key == "Disk rotation time {msec}")
+	{
+		diskRotationTime = number;
+	}
+	else if (key == "Disk deadline {msec}")
+	{
+		diskDeadline = number;
+	}
+	else if (key == "Disk batch size")
+	{
+		diskBatchSize = number;
+	}
+	else if (key == "Disk batch window {msec}")
+	{
+		diskBatchWindow = number;
+	}
+	else if (key == "Buffer cache size {blocks}")
+	{
+		cacheSize = number;
+	}
+	else if (key == "Buffer cache read ahead {blocks}")
+	{
+		cacheReadAhead = number;
+	}
+	else if (key == "Buffer cache flush threshold {blocks}")
+	{
+		cacheFlushThreshold = number;
+	}
+	else if (key == "Interrupt handler time {msec}")
+	{
+		interruptHandlerTime = number;
+	}
+	else if (key == "Interrupt coalescing count")
+	{
+		interruptCoalesceCount = number;
+	}
+	else if (key == "Interrupt coalescing time {msec}")
+	{
+		interruptCoalesceTime = number;
+	}
+	else if (key == "Random seed")
+	{
+		randomSeed = number;
+	}
+	else
+	{
+		return 0;
+	}
+	return 1;
+
+}
+
+/**
+*	Function: parseCpuScheduleCode
+*	Description: Converts the name of a cpu scheduling algorithm (FIFO, PS, SJF, STR or 
+*		RR) to its schedule code. Returns -1 if the name is not recognized.
+*/
+int Config::parseCpuScheduleCode(string name)
+{
+	if (name == "FIFO")
+	{
+		return 0;
+	}
+	else if (name == "PS")
+	{
+		return 1;
+	}
+	else if (name == "SJF")
+	{
+		return 2;
+	}
+	else if (name == "STR")
+	{
+		return 3;
+	}
+	else if (name == "RR")
+	{
+		return 4;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parseDiskScheduleCode
+*	Description: Converts the name of a disk scheduling algorithm (FCFS, SSTF, SCAN, 
+*		C-LOOK or DEADLINE) to its DiskScheduleCode. Returns -1 if the name is not 
+*		recognized.
+*/
+int Config::parseDiskScheduleCode(string name)
+{
+	if (name == "FCFS")
+	{
+		return DISK_FCFS;
+	}
+	else if (name == "SSTF")
+	{
+		return DISK_SSTF;
+	}
+	else if (name == "SCAN")
+	{
+		return DISK_SCAN;
+	}
+	else if (name == "C-LOOK")
+	{
+		return DISK_CLOOK;
+	}
+	else if (name == "DEADLINE")
+	{
+		return DISK_DEADLINE;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parseDispatchPolicyCode
+*	Description: Converts the name of a device dispatch policy (PER PROCESS, SHORTEST 
+*		QUEUE or TWO CHOICES) to its DispatchPolicyCode. Returns -1 if the name is not 
+*		recognized.
+*/
+int Config::parseDispatchPolicyCode(string name)
+{
+	if (name == "PER PROCESS")
+	{
+		return DISPATCH_PER_PROCESS;
+	}
+	else if (name == "SHORTEST QUEUE")
+	{
+		return DISPATCH_SHORTEST_QUEUE;
+	}
+	else if (name == "TWO CHOICES")
+	{
+		return DISPATCH_TWO_CHOICES;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parseCachePolicyCode
+*	Description: Converts the name of a buffer cache eviction policy (LRU or 2Q) to
+*		its CachePolicyCode. Returns -1 if the name is not recognized.
+*/
+int Config::parseCachePolicyCode(string name)
+{
+	if (name == "LRU")
+	{
+		return CACHE_LRU;
+	}
+	else if (name == "2Q")
+	{
+		return CACHE_2Q;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parseDecisionLogMode
+*	Description: Converts what a run does with its decisions (Off, Record or Replay) 
+*		to its DecisionLogMode. Returns -1 if the name is not recognized.
+*/
+int Config::parseDecisionLogMode(string name)
+{
+	if (name == "Off")
+	{
+		return DECISIONS_OFF;
+	}
+	else if (name == "Record")
+	{
+		return DECISIONS_RECORD;
+	}
+	else if (name == "Replay")
+	{
+		return DECISIONS_REPLAY;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parseTimerWaitMode
+*	Description: Converts how the timers wait (Hybrid, sleeping before spinning, or 
+*		Spin) to its TimerWaitMode. Returns -1 if the name is not recognized.
+*/
+int Config::parseTimerWaitMode(string name)
+{
+	if (name == "Hybrid")
+	{
+		return TIMER_HYBRID;
+	}
+	else if (name == "Spin")
+	{
+		return TIMER_SPIN;
+	}
+	else return -1;
+}
+
+/**
+*	Function: parsePositiveInt
+*	Description: Converts the string word to an int stored in number. Returns true if 
+*		word is made up only of digits and its value is greater than zero, returns 
+*		false otherwise.
+*/
+bool Config::parsePositiveInt(string word, int& number)
+{
+	if (word.empty() || word.length() > 9)
+	{
+		return 0;
+	}
+	for (int i = 0; i < word.length(); i++)
+	{
+		if (word[i] < '0' || word[i] > '9')
+		{
+			return 0;
+		}
+	}
+	number = atoi(word.c_str());
+	return number > 0;
+}
+
 /**
 *	Function: getLogType
 *	Description: returns the log type specified in the configuration file
@@ -647,6 +1146,30 @@ int Config::getCpuScheduleCode()
 	return cpuScheduleCode;
 }
 
+/**
+*	Function: getCpuScheduleName
+*	Description: returns the name of the cpu schedule code specified in the 
+*				 configuration file
+*/
+string Config::getCpuScheduleName()
+{
+	switch (cpuScheduleCode)
+	{
+		case 0:
+			return "FIFO";
+		case 1:
+			return "PS";
+		case 2:
+			return "SJF";
+		case 3:
+			return "STR";
+		case 4:
+			return "RR";
+		default:
+			return "UNKNOWN";
+	}
+}
+
 /**
 *	Function: getProjectorTime
 *	Description: returns the projector time (msec) specified in the configuration file
@@ -749,30 +1272,370 @@ int Config::getProjQuant()
 }
 
 /**
-*	Function: getVersion
-*	Description: returns the version number specified in the configuration file
+*	Function: getKeyboardQuant
+*	Description: returns the number of keyboards, 1 unless the configuration file 
+*		gives a keyboard quantity
 */
-float Config::getVersion()
+int Config::getKeyboardQuant()
 {
-	return version;
+	return keyboardQuant;
 }
 
 /**
-*	Function: getFilePath
-*	Description: returns the meta-data file path specified in the configuration file
+*	Function: getScannerQuant
+*	Description: returns the number of scanners, 1 unless the configuration file gives 
+*		a scanner quantity
 */
-string Config::getFilePath()
+int Config::getScannerQuant()
 {
-	return filePath;
+	return scannerQuant;
 }
 
 /**
-*	Function: getLogPath
-*	Description: returns the log file path specified in the configuration file
+*	Function: getMonitorQuant
+*	Description: returns the number of monitors, 1 unless the configuration file gives 
+*		a monitor quantity
 */
-string Config::getLogPath()
+int Config::getMonitorQuant()
 {
-	return logPath;
+	return monitorQuant;
+}
+
+/**
+*	Function: getDeviceQuant
+*	Description: returns the number of units of the device with the parameter 
+*		DeviceId, at least 1. The processor and memory are a single unit.
+*/
+int Config::getDeviceQuant(int device)
+{
+	int quantity = 1;
+	switch (device)
+	{
+		case DEVICE_HARD_DRIVE:
+			quantity = hddQuant;
+		break;
+		case DEVICE_KEYBOARD:
+			quantity = keyboardQuant;
+		break;
+		case DEVICE_SCANNER:
+			quantity = scannerQuant;
+		break;
+		case DEVICE_MONITOR:
+			quantity = monitorQuant;
+		break;
+		case DEVICE_PROJECTOR:
+			quantity = projQuant;
+		break;
+	}
+	return quantity > 0 ? quantity : 1;
+}
+
+/**
+*	Function: getVersion
+*	Description: returns the version number specified in the configuration file
+*/
+float Config::getVersion()
+{
+	return version;
+}
+
+/**
+*	Function: getFilePath
+*	Description: returns the meta-data file path specified in the configuration file
+*/
+string Config::getFilePath()
+{
+	return filePath;
+}
+
+/**
+*	Function: getLogPath
+*	Description: returns the log file path specified in the configuration file
+*/
+string Config::getLogPath()
+{
+	return logPath;
+}
+
+/**
+*	Function: getDeviceSampleInterval
+*	Description: returns the milliseconds between samples of the device telemetry, 0 
+*		if the devices are not sampled
+*/
+int Config::getDeviceSampleInterval()
+{
+	return deviceSampleInterval;
+}
+
+/**
+*	Function: getDiskScheduleCode
+*	Description: returns the DiskScheduleCode the hard drives serve their requests with
+*/
+int Config::getDiskScheduleCode()
+{
+	return diskScheduleCode;
+}
+
+/**
+*	Function: getDiskScheduleName
+*	Description: returns the name of the disk scheduling algorithm
+*/
+string Config::getDiskScheduleName()
+{
+	switch (diskScheduleCode)
+	{
+		case DISK_FCFS:
+			return "FCFS";
+		case DISK_SSTF:
+			return "SSTF";
+		case DISK_SCAN:
+			return "SCAN";
+		case DISK_CLOOK:
+			return "C-LOOK";
+		case DISK_DEADLINE:
+			return "DEADLINE";
+		default:
+			return "UNKNOWN";
+	}
+}
+
+/**
+*	Function: getDiskTracks
+*	Description: returns the number of tracks of every hard drive
+*/
+int Config::getDiskTracks()
+{
+	return diskTracks;
+}
+
+/**
+*	Function: getDiskBlocksPerTrack
+*	Description: returns the number of blocks on each track of a hard drive
+*/
+int Config::getDiskBlocksPerTrack()
+{
+	return diskBlocksPerTrack;
+}
+
+/**
+*	Function: getDiskTrackSeekTime
+*	Description: returns the time (usec) the head of a hard drive takes to move across 
+*		one track
+*/
+int Config::getDiskTrackSeekTime()
+{
+	return diskTrackSeekTime;
+}
+
+/**
+*	Function: getDiskRotationTime
+*	Description: returns the time (msec) of one revolution of a hard drive
+*/
+int Config::getDiskRotationTime()
+{
+	return diskRotationTime;
+}
+
+/**
+*	Function: getDiskDeadline
+*	Description: returns the time (msec) a hard drive request may wait before the 
+*		DEADLINE algorithm serves it ahead of the others
+*/
+int Config::getDiskDeadline()
+{
+	return diskDeadline;
+}
+
+/**
+*	Function: getDiskBatchSize
+*	Description: returns the most requests a hard drive serves with one operation
+*/
+int Config::getDiskBatchSize()
+{
+	return diskBatchSize;
+}
+
+/**
+*	Function: getDiskBatchWindow
+*	Description: returns the milliseconds an idle hard drive holds its oldest request 
+*		so that others can join its operation
+*/
+int Config::getDiskBatchWindow()
+{
+	return diskBatchWindow;
+}
+
+/**
+*	Function: getDispatchPolicyCode
+*	Description: returns the DispatchPolicyCode requests are spread over the units of 
+*		the hard drives and projectors with
+*/
+int Config::getDispatchPolicyCode()
+{
+	return dispatchPolicyCode;
+}
+
+/**
+*	Function: getDispatchPolicyName
+*	Description: returns the name of the device dispatch policy
+*/
+string Config::getDispatchPolicyName()
+{
+	switch (dispatchPolicyCode)
+	{
+		case DISPATCH_PER_PROCESS:
+			return "PER PROCESS";
+		case DISPATCH_SHORTEST_QUEUE:
+			return "SHORTEST QUEUE";
+		case DISPATCH_TWO_CHOICES:
+			return "TWO CHOICES";
+		default:
+			return "UNKNOWN";
+	}
+}
+
+/**
+*	Function: getCacheSize
+*	Description: returns the number of blocks the buffer cache holds, 0 if there is no 
+*		buffer cache
+*/
+int Config::getCacheSize()
+{
+	return cacheSize;
+}
+
+/**
+*	Function: getCachePolicyCode
+*	Description: returns the CachePolicyCode the buffer cache evicts blocks with
+*/
+int Config::getCachePolicyCode()
+{
+	return cachePolicyCode;
+}
+
+/**
+*	Function: getCachePolicyName
+*	Description: returns the name of the buffer cache eviction policy
+*/
+string Config::getCachePolicyName()
+{
+	switch (cachePolicyCode)
+	{
+		case CACHE_LRU:
+			return "LRU";
+		case CACHE_2Q:
+			return "2Q";
+		default:
+			return "UNKNOWN";
+	}
+}
+
+/**
+*	Function: getCacheReadAhead
+*	Description: returns the number of blocks the buffer cache reads ahead of a 
+*		sequential read
+*/
+int Config::getCacheReadAhead()
+{
+	return cacheReadAhead;
+}
+
+/**
+*	Function: getCacheFlushThreshold
+*	Description: returns the number of dirty blocks at which the buffer cache writes 
+*		its dirty blocks back
+*/
+int Config::getCacheFlushThreshold()
+{
+	return cacheFlushThreshold;
+}
+
+/**
+*	Function: getInterruptHandlerTime
+*	Description: returns the milliseconds of processor time each interrupt takes
+*/
+int Config::getInterruptHandlerTime()
+{
+	return interruptHandlerTime;
+}
+
+/**
+*	Function: getInterruptCoalesceCount
+*	Description: returns the number of device completions delivered by one interrupt
+*/
+int Config::getInterruptCoalesceCount()
+{
+	return interruptCoalesceCount;
+}
+
+/**
+*	Function: getInterruptCoalesceTime
+*	Description: returns the milliseconds a device completion may wait for the others 
+*		of its interrupt, 0 if it waits until enough have gathered
+*/
+int Config::getInterruptCoalesceTime()
+{
+	return interruptCoalesceTime;
+}
+
+/**
+*	Function: getRandomSeed
+*	Description: returns the seed of the random numbers of a run, 0 if they are seeded 
+*		from the clock ("Random seed: Time"). Runs use seed 1 unless told otherwise.
+*/
+int Config::getRandomSeed()
+{
+	return randomSeed;
+}
+
+/**
+*	Function: getDecisionLogMode
+*	Description: returns whether the scheduling decisions of a run are recorded or 
+*		replayed, as a DecisionLogMode
+*/
+int Config::getDecisionLogMode()
+{
+	return decisionLogMode;
+}
+
+/**
+*	Function: getDecisionLogPath
+*	Description: returns the path of the file decisions are recorded to or replayed 
+*		from
+*/
+string Config::getDecisionLogPath()
+{
+	return decisionLogPath;
+}
+
+/**
+*	Function: getAnalyticFastPath
+*	Description: returns whether runs without preemption or contention are worked out 
+*		in closed form instead of run by threads
+*/
+bool Config::getAnalyticFastPath()
+{
+	return analyticFastPath;
+}
+
+/**
+*	Function: getTimeScale
+*	Description: returns how much real time the threads take per unit of simulated 
+*		time, below 1 to run the program faster than real time
+*/
+double Config::getTimeScale()
+{
+	return timeScale;
+}
+
+/**
+*	Function: getTimerWaitMode
+*	Description: returns whether the timers sleep before spinning or only spin, as a 
+*		TimerWaitMode
+*/
+int Config::getTimerWaitMode()
+{
+	return timerWaitMode;
 }
 
 /**
@@ -901,6 +1764,33 @@ void Config::setProjQuant(int source)
 	projQuant = source;
 }
 
+/**
+*	Function: setKeyboardQuant
+*	Description: sets the keyboard quantity to the parameter: source
+*/
+void Config::setKeyboardQuant(int source)
+{
+	keyboardQuant = source;
+}
+
+/**
+*	Function: setScannerQuant
+*	Description: sets the scanner quantity to the parameter: source
+*/
+void Config::setScannerQuant(int source)
+{
+	scannerQuant = source;
+}
+
+/**
+*	Function: setMonitorQuant
+*	Description: sets the monitor quantity to the parameter: source
+*/
+void Config::setMonitorQuant(int source)
+{
+	monitorQuant = source;
+}
+
 /**
 *	Function: setVersion
 *	Description: sets the version number to the parameter: source
@@ -928,6 +1818,213 @@ void Config::setLogPath(string source)
 	logPath = source;
 }
 
+/**
+*	Function: setDeviceSampleInterval
+*	Description: sets the deviceSampleInterval to the parameter source
+*/
+void Config::setDeviceSampleInterval(int source)
+{
+	deviceSampleInterval = source;
+}
+
+/**
+*	Function: setDiskScheduleCode
+*	Description: sets the diskScheduleCode to the parameter source
+*/
+void Config::setDiskScheduleCode(int source)
+{
+	diskScheduleCode = source;
+}
+
+/**
+*	Function: setDiskTracks
+*	Description: sets the diskTracks to the parameter source
+*/
+void Config::setDiskTracks(int source)
+{
+	diskTracks = source;
+}
+
+/**
+*	Function: setDiskBlocksPerTrack
+*	Description: sets the diskBlocksPerTrack to the parameter source
+*/
+void Config::setDiskBlocksPerTrack(int source)
+{
+	diskBlocksPerTrack = source;
+}
+
+/**
+*	Function: setDiskTrackSeekTime
+*	Description: sets the diskTrackSeekTime to the parameter source
+*/
+void Config::setDiskTrackSeekTime(int source)
+{
+	diskTrackSeekTime = source;
+}
+
+/**
+*	Function: setDiskRotationTime
+*	Description: sets the diskRotationTime to the parameter source
+*/
+void Config::setDiskRotationTime(int source)
+{
+	diskRotationTime = source;
+}
+
+/**
+*	Function: setDiskDeadline
+*	Description: sets the diskDeadline to the parameter source
+*/
+void Config::setDiskDeadline(int source)
+{
+	diskDeadline = source;
+}
+
+/**
+*	Function: setDiskBatchSize
+*	Description: sets the diskBatchSize to the parameter source
+*/
+void Config::setDiskBatchSize(int source)
+{
+	diskBatchSize = source;
+}
+
+/**
+*	Function: setDiskBatchWindow
+*	Description: sets the diskBatchWindow to the parameter source
+*/
+void Config::setDiskBatchWindow(int source)
+{
+	diskBatchWindow = source;
+}
+
+/**
+*	Function: setDispatchPolicyCode
+*	Description: sets the dispatchPolicyCode to the parameter source
+*/
+void Config::setDispatchPolicyCode(int source)
+{
+	dispatchPolicyCode = source;
+}
+
+/**
+*	Function: setCacheSize
+*	Description: sets the cacheSize to the parameter source
+*/
+void Config::setCacheSize(int source)
+{
+	cacheSize = source;
+}
+
+/**
+*	Function: setCachePolicyCode
+*	Description: sets the cachePolicyCode to the parameter source
+*/
+void Config::setCachePolicyCode(int source)
+{
+	cachePolicyCode = source;
+}
+
+/**
+*	Function: setCacheReadAhead
+*	Description: sets the cacheReadAhead to the parameter source
+*/
+void Config::setCacheReadAhead(int source)
+{
+	cacheReadAhead = source;
+}
+
+/**
+*	Function: setCacheFlushThreshold
+*	Description: sets the cacheFlushThreshold to the parameter source
+*/
+void Config::setCacheFlushThreshold(int source)
+{
+	cacheFlushThreshold = source;
+}
+
+/**
+*	Function: setInterruptHandlerTime
+*	Description: sets the interruptHandlerTime to the parameter source
+*/
+void Config::setInterruptHandlerTime(int source)
+{
+	interruptHandlerTime = source;
+}
+
+/**
+*	Function: setInterruptCoalesceCount
+*	Description: sets the interruptCoalesceCount to the parameter source
+*/
+void Config::setInterruptCoalesceCount(int source)
+{
+	interruptCoalesceCount = source;
+}
+
+/**
+*	Function: setInterruptCoalesceTime
+*	Description: sets the interruptCoalesceTime to the parameter source
+*/
+void Config::setInterruptCoalesceTime(int source)
+{
+	interruptCoalesceTime = source;
+}
+
+/**
+*	Function: setRandomSeed
+*	Description: sets the randomSeed to the parameter source
+*/
+void Config::setRandomSeed(int source)
+{
+	randomSeed = source;
+}
+
+/**
+*	Function: setDecisionLogMode
+*	Description: sets the decisionLogMode to the parameter source
+*/
+void Config::setDecisionLogMode(int source)
+{
+	decisionLogMode = source;
+}
+
+/**
+*	Function: setDecisionLogPath
+*	Description: sets the decisionLogPath to the parameter source
+*/
+void Config::setDecisionLogPath(string source)
+{
+	decisionLogPath = source;
+}
+
+/**
+*	Function: setAnalyticFastPath
+*	Description: sets the analyticFastPath to the parameter source
+*/
+void Config::setAnalyticFastPath(bool source)
+{
+	analyticFastPath = source;
+}
+
+/**
+*	Function: setTimeScale
+*	Description: sets the timeScale to the parameter source
+*/
+void Config::setTimeScale(double source)
+{
+	timeScale = source;
+}
+
+/**
+*	Function: setTimerWaitMode
+*	Description: sets the timerWaitMode to the parameter source
+*/
+void Config::setTimerWaitMode(int source)
+{
+	timerWaitMode = source;
+}
+
 /**
 *	Function: convertToKiloytes
 *	Description: converts data from dataType to kilobytes
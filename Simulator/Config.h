@@ -20,6 +20,43 @@
 
 using namespace std;
 
+//ids of the devices an instruction can use, used to index a table of device times
+enum DeviceId
+{
+	DEVICE_NONE, DEVICE_PROCESSOR, DEVICE_MEMORY, DEVICE_HARD_DRIVE, DEVICE_KEYBOARD,
+	DEVICE_SCANNER, DEVICE_MONITOR, DEVICE_PROJECTOR, DEVICE_COUNT
+};
+
+//algorithms a hard drive can serve its request queue with
+enum DiskScheduleCode
+{
+	DISK_FCFS, DISK_SSTF, DISK_SCAN, DISK_CLOOK, DISK_DEADLINE
+};
+
+//ways the requests for a device with several units are spread over the units
+enum DispatchPolicyCode
+{
+	DISPATCH_PER_PROCESS, DISPATCH_SHORTEST_QUEUE, DISPATCH_TWO_CHOICES
+};
+
+//what a run does with its scheduling decisions, see DecisionLog
+enum DecisionLogMode
+{
+	DECISIONS_OFF, DECISIONS_RECORD, DECISIONS_REPLAY
+};
+
+//how the timers of the simulator wait, see PreciseWaiter
+enum TimerWaitMode
+{
+	TIMER_HYBRID, TIMER_SPIN
+};
+
+//eviction policies of the buffer cache in front of the hard drives
+enum CachePolicyCode
+{
+	CACHE_LRU, CACHE_2Q
+};
+
 class Config
 {
 
@@ -34,10 +71,20 @@ class Config
 		int getKeywordIndex(string);
 		bool parseComponentTime(string, string, int, int&);
 		int getComponentTime(char, string);
+		void getDeviceTimeTable(int[DEVICE_COUNT]);
+		bool applySetting(string, string);
+		int parseCpuScheduleCode(string);
+		int parseDiskScheduleCode(string);
+		int parseDispatchPolicyCode(string);
+		int parseCachePolicyCode(string);
+		int parseDecisionLogMode(string);
+		int parseTimerWaitMode(string);
+		bool parsePositiveInt(string, int&);
 		
 		int getLogType();
 		int getProcessorQuantumNumber();
 		int getCpuScheduleCode();
+		string getCpuScheduleName();
 		int getProjectorTime();
 		int getProcessorTime();
 		int getKeyboardTime();
@@ -49,9 +96,39 @@ class Config
 		int getBlockSize();
 		int getHddQuant();
 		int getProjQuant();
+		int getKeyboardQuant();
+		int getScannerQuant();
+		int getMonitorQuant();
+		int getDeviceQuant(int);
 		float getVersion();
 		string getFilePath();
 		string getLogPath();
+		int getDeviceSampleInterval();
+		int getDiskScheduleCode();
+		string getDiskScheduleName();
+		int getDiskTracks();
+		int getDiskBlocksPerTrack();
+		int getDiskTrackSeekTime();
+		int getDiskRotationTime();
+		int getDiskDeadline();
+		int getDiskBatchSize();
+		int getDiskBatchWindow();
+		int getDispatchPolicyCode();
+		string getDispatchPolicyName();
+		int getCacheSize();
+		int getCachePolicyCode();
+		string getCachePolicyName();
+		int getCacheReadAhead();
+		int getCacheFlushThreshold();
+		int getInterruptHandlerTime();
+		int getInterruptCoalesceCount();
+		int getInterruptCoalesceTime();
+		int getRandomSeed();
+		int getDecisionLogMode();
+		string getDecisionLogPath();
+		bool getAnalyticFastPath();
+		double getTimeScale();
+		int getTimerWaitMode();
 		
 		void setLogType(int);
 		void setProcessorQuantumNumber(int);
@@ -67,9 +144,35 @@ class Config
 		void setBlockSize(int);
 		void setHddQuant(int);
 		void setProjQuant(int);
+		void setKeyboardQuant(int);
+		void setScannerQuant(int);
+		void setMonitorQuant(int);
 		void setVersion(float);
 		void setFilePath(string);
 		void setLogPath(string);
+		void setDeviceSampleInterval(int);
+		void setDiskScheduleCode(int);
+		void setDiskTracks(int);
+		void setDiskBlocksPerTrack(int);
+		void setDiskTrackSeekTime(int);
+		void setDiskRotationTime(int);
+		void setDiskDeadline(int);
+		void setDiskBatchSize(int);
+		void setDiskBatchWindow(int);
+		void setDispatchPolicyCode(int);
+		void setCacheSize(int);
+		void setCachePolicyCode(int);
+		void setCacheReadAhead(int);
+		void setCacheFlushThreshold(int);
+		void setInterruptHandlerTime(int);
+		void setInterruptCoalesceCount(int);
+		void setInterruptCoalesceTime(int);
+		void setRandomSeed(int);
+		void setDecisionLogMode(int);
+		void setDecisionLogPath(string);
+		void setAnalyticFastPath(bool);
+		void setTimeScale(double);
+		void setTimerWaitMode(int);
 		
 		int convertToKilobytes(int, char);
 	
@@ -93,6 +196,40 @@ class Config
 		float version;
 		
 		string filePath, logPath;	
+		
+		//optional settings, given after the log file path
+		int deviceSampleInterval; //msec between device samples, 0 for none
+		int keyboardQuant, scannerQuant, monitorQuant; //units, see DeviceDispatcher
+		
+		//geometry and request scheduling of every hard drive, see DiskModel
+		int diskScheduleCode;
+		int diskTracks, diskBlocksPerTrack;
+		int diskTrackSeekTime; //usec to move the head across one track, 0 for none
+		int diskRotationTime; //msec per revolution, 0 for no rotational latency
+		int diskDeadline; //msec a request may wait before DEADLINE serves it first
+		int diskBatchSize; //most requests served by one operation of the drive
+		int diskBatchWindow; //msec an idle drive holds a request for others to join
+		
+		int dispatchPolicyCode; //see DeviceDispatcher
+		
+		//buffer cache of the hard drives, see BufferCache
+		int cacheSize; //blocks, 0 for no cache
+		int cachePolicyCode;
+		int cacheReadAhead; //blocks fetched after a sequential read that missed
+		int cacheFlushThreshold; //dirty blocks that are written back together
+		
+		//delivery of device completions to the processor, see InterruptController
+		int interruptHandlerTime; //msec of processor time per interrupt
+		int interruptCoalesceCount; //completions delivered by one interrupt
+		int interruptCoalesceTime; //msec a completion may wait, 0 for no limit
+		
+		//repeatable runs, see DecisionLog
+		int randomSeed; //1 by default, 0 to seed the random numbers from the clock
+		int decisionLogMode;
+		string decisionLogPath;
+		bool analyticFastPath; //works out runs EventEngine::evaluate() can instead
+		double timeScale; //real time per unit of simulated time, 1 for real time
+		int timerWaitMode;
 
 };
 
@@ -0,0 +1,329 @@
+/**
+*	File Name: DecisionLog.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class DecisionLog. Records the
+*		scheduling decisions of a run (dispatches, preemptions and device assignments)
+*		with the seed of its random numbers, and replays them in a later run, counting
+*		the decisions that came out differently
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "DecisionLog.h"
+#include <sstream>
+#include "Logger.h"
+
+const char* DecisionLog::LOG_MAGIC = "SIMDECISIONS";
+
+/**
+*	Function: DecisionLog
+*	Description: Default constructor for DecisionLog class, nothing is recorded until
+*		reset() is called with another mode
+*/
+DecisionLog::DecisionLog()
+{
+
+	pthread_mutex_init(&mutexDecision, NULL);
+	seed = 0;
+	reset(DECISIONS_OFF);
+
+}
+
+/**
+*	Function: ~DecisionLog
+*	Description: Destructor for DecisionLog class
+*/
+DecisionLog::~DecisionLog()
+{
+
+	pthread_mutex_destroy(&mutexDecision);
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every decision made and loaded. With modeSource
+*		DECISIONS_RECORD the decisions of the run are kept for save(), with
+*		DECISIONS_REPLAY the decisions loaded by load() are replayed.
+*/
+void DecisionLog::reset(int modeSource)
+{
+
+	pthread_mutex_lock(&mutexDecision);
+	mode = modeSource;
+	decisions.clear();
+	recorded.clear();
+	cursors.clear();
+	matched = 0;
+	diverged = 0;
+	firstDivergence.clear();
+	pthread_mutex_unlock(&mutexDecision);
+
+}
+
+/**
+*	Function: getMode
+*	Description: returns the DecisionLogMode the log was reset with
+*/
+int DecisionLog::getMode()
+{
+
+	return mode;
+
+}
+
+/**
+*	Function: getSeed
+*	Description: returns the seed of the random numbers of the run
+*/
+unsigned int DecisionLog::getSeed()
+{
+
+	return seed;
+
+}
+
+/**
+*	Function: setSeed
+*	Description: sets the seed saved with the decisions to source
+*/
+void DecisionLog::setSeed(unsigned int source)
+{
+
+	seed = source;
+
+}
+
+/**
+*	Function: load
+*	Description: Reads a decision log written by save() from in to be replayed, and
+*		takes over its seed so the random numbers repeat too. Returns false if in is
+*		not a decision log of this version.
+*/
+bool DecisionLog::load(istream& in)
+{
+
+	string magic, line;
+	int version = 0;
+	unsigned int loadedSeed = 0;
+	in >> magic >> version >> loadedSeed;
+	if (magic != LOG_MAGIC || version != LOG_VERSION)
+	{
+		return 0;
+	}
+	getline(in, line);
+	
+	map<long long, vector<int> > loaded;
+	while (getline(in, line))
+	{
+		stringstream fields(line);
+		string name;
+		int process, device, choice, kind = 0;
+		if (!(fields >> name >> process >> device >> choice))
+		{
+			return 0;
+		}
+		while (kind < DECISION_KIND_COUNT && name != getKindName(kind))
+		{
+			kind++;
+		}
+		if (kind == DECISION_KIND_COUNT)
+		{
+			return 0;
+		}
+		loaded[keyOf(kind, process, device)].push_back(choice);
+	}
+	
+	pthread_mutex_lock(&mutexDecision);
+	recorded.swap(loaded);
+	cursors.clear();
+	seed = loadedSeed;
+	pthread_mutex_unlock(&mutexDecision);
+	
+	return 1;
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the header with the seed, then one line per decision in the
+*		order they were made: the kind, the pid it was made for (0 for the processor),
+*		the DeviceId and the choice. Returns false if it could not be written.
+*/
+bool DecisionLog::save(ostream& out)
+{
+
+	pthread_mutex_lock(&mutexDecision);
+	out << LOG_MAGIC << " " << LOG_VERSION << " " << seed << endl;
+	for (int i = 0; i < decisions.size(); i++)
+	{
+		Decision& decision = decisions[i];
+		out << getKindName(decision.kind) << " " << decision.process << " "
+			<< decision.device << " " << decision.choice << endl;
+	}
+	pthread_mutex_unlock(&mutexDecision);
+	
+	return out.good();
+
+}
+
+/**
+*	Function: replay
+*	Description: returns the choice the recorded run made for its next decision of
+*		kind for process on device, -1 if the log is not replaying or the recorded run
+*		made no more such decisions. The decision counts as made once record() is
+*		called for it.
+*/
+int DecisionLog::replay(int kind, int process, int device)
+{
+
+	int choice = -1;
+	
+	pthread_mutex_lock(&mutexDecision);
+	if (mode == DECISIONS_REPLAY)
+	{
+		long long key = keyOf(kind, process, device);
+		map<long long, vector<int> >::iterator stream = recorded.find(key);
+		int next = cursors[key];
+		if (stream != recorded.end() && next < stream->second.size())
+		{
+			choice = stream->second[next];
+		}
+	}
+	pthread_mutex_unlock(&mutexDecision);
+	
+	return choice;
+
+}
+
+/**
+*	Function: record
+*	Description: Records that a decision of kind for process on device chose choice.
+*		Dispatches and preemptions are made for the processor (process 0) and choose a
+*		pid, device assignments choose a unit. Every kind, process and device is a
+*		stream of its own, so threads deciding for different processes do not change
+*		what is replayed. When replaying, the choice is compared with the one
+*		recorded.
+*/
+void DecisionLog::record(int kind, int process, int device, int choice)
+{
+
+	if (mode == DECISIONS_OFF)
+	{
+		return;
+	}
+	
+	Decision decision = {kind, process, device, choice};
+	pthread_mutex_lock(&mutexDecision);
+	decisions.push_back(decision);
+	if (mode == DECISIONS_REPLAY)
+	{
+		long long key = keyOf(kind, process, device);
+		vector<int>& stream = recorded[key];
+		int next = cursors[key]++;
+		if (next < stream.size() && stream[next] == choice)
+		{
+			matched++;
+		}
+		else if (diverged++ == 0)
+		{
+			stringstream description;
+			description << getKindName(kind) << " " << next + 1;
+			if (kind == DECISION_ASSIGN)
+			{
+				description << " of process " << process << " on "
+							<< Logger::getUnitName(device) << ": unit ";
+			}
+			else
+			{
+				description << ": process ";
+			}
+			description << choice << " instead of ";
+			if (next < stream.size())
+			{
+				description << stream[next];
+			}
+			else
+			{
+				description << "none";
+			}
+			firstDivergence = description.str();
+		}
+	}
+	pthread_mutex_unlock(&mutexDecision);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes how many decisions of each kind were made to out and, when
+*		replaying, how many matched the recorded run and the first that did not.
+*		Writes only the seed of the run if the log is off, so the run can be repeated.
+*/
+void DecisionLog::print(ostream& out)
+{
+
+	int counts[DECISION_KIND_COUNT] = {0};
+	
+	pthread_mutex_lock(&mutexDecision);
+	if (mode == DECISIONS_OFF)
+	{
+		out << endl << "Random seed: " << seed << endl;
+		pthread_mutex_unlock(&mutexDecision);
+		return;
+	}
+	for (int i = 0; i < decisions.size(); i++)
+	{
+		counts[decisions[i].kind]++;
+	}
+	
+	out << endl << "Decision Log (" << (mode == DECISIONS_RECORD ? "recorded" :
+		"replayed") << ", seed " << seed << ")" << endl;
+	for (int i = 0; i < DECISION_KIND_COUNT; i++)
+	{
+		out << getKindName(i) << ": " << counts[i] << endl;
+	}
+	if (mode == DECISIONS_REPLAY)
+	{
+		out << "matched: " << matched << ", diverged: " << diverged << endl;
+		if (diverged > 0)
+		{
+			out << "first divergence: " << firstDivergence << endl;
+		}
+	}
+	pthread_mutex_unlock(&mutexDecision);
+
+}
+
+/**
+*	Function: keyOf
+*	Description: returns the key of the stream of decisions of kind for process on
+*		device
+*/
+long long DecisionLog::keyOf(int kind, int process, int device)
+{
+
+	return ((long long) process * DEVICE_COUNT + device) * DECISION_KIND_COUNT + kind;
+
+}
+
+/**
+*	Function: getKindName
+*	Description: returns the name a decision of kind is saved under
+*/
+const char* DecisionLog::getKindName(int kind)
+{
+
+	switch (kind)
+	{
+		case DECISION_DISPATCH:
+			return "dispatch";
+		case DECISION_PREEMPT:
+			return "preempt";
+		case DECISION_ASSIGN:
+			return "assign";
+	}
+	return "unknown";
+
+}
@@ -0,0 +1,83 @@
+/**
+*	File Name: DecisionLog.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class DecisionLog. Records the scheduling
+*		decisions of a run (dispatches, preemptions and device assignments) with the
+*		seed of its random numbers, and replays them in a later run, counting the
+*		decisions that came out differently
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef DECISION_LOG_
+#define DECISION_LOG_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <pthread.h>
+#include "Config.h"
+
+using namespace std;
+
+//decisions a run makes that depend on the timing of its threads
+enum DecisionKind
+{
+	DECISION_DISPATCH, DECISION_PREEMPT, DECISION_ASSIGN, DECISION_KIND_COUNT
+};
+
+class DecisionLog
+{
+
+	//DecisionLog class public declarations
+	public:
+	
+		DecisionLog();
+		~DecisionLog();
+	
+		void reset(int);
+		int getMode();
+		unsigned int getSeed();
+		void setSeed(unsigned int);
+		bool load(istream&);
+		bool save(ostream&);
+	
+		int replay(int, int, int);
+		void record(int, int, int, int);
+		void print(ostream&);
+	
+		//decision logs start with LOG_MAGIC followed by LOG_VERSION and the seed
+		static const char* LOG_MAGIC;
+		static const int LOG_VERSION = 1;
+	
+	//DecisionLog class private declarations
+	private:
+	
+		struct Decision
+		{
+			int kind; //DecisionKind
+			int process; //pid the decision was made for, 0 for the processor
+			int device; //DeviceId
+			int choice; //pid dispatched or preempted, or unit assigned
+		};
+	
+		long long keyOf(int, int, int);
+		static const char* getKindName(int);
+	
+		int mode; //DecisionLogMode
+		unsigned int seed;
+		vector<Decision> decisions; //in the order they were made
+		map<long long, vector<int> > recorded; //choices of every stream, to replay
+		map<long long, int> cursors; //choices of every stream made so far
+		long matched, diverged;
+		string firstDivergence;
+	
+		pthread_mutex_t mutexDecision;
+	
+};
+
+#endif
@@ -0,0 +1,430 @@
+/**
+*	File Name: DeviceDispatcher.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class DeviceDispatcher. Keeps a pool
+*		of units for every device class, assigns the requests of every process to a
+*		unit by one shared policy and reports how evenly the units were loaded
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "DeviceDispatcher.h"
+#include <stdio.h>
+#include <limits.h>
+#include "Logger.h"
+
+/**
+*	Function: DeviceDispatcher
+*	Description: Default constructor for DeviceDispatcher class
+*/
+DeviceDispatcher::DeviceDispatcher()
+{
+
+	pthread_mutex_init(&mutexDispatch, NULL);
+	pthread_cond_init(&unitReleased, NULL);
+	decisions = NULL;
+	
+	Config configData;
+	configData.setHddQuant(1);
+	configData.setProjQuant(1);
+	reset(configData);
+
+}
+
+/**
+*	Function: ~DeviceDispatcher
+*	Description: Destructor for DeviceDispatcher class
+*/
+DeviceDispatcher::~DeviceDispatcher()
+{
+
+	pthread_cond_destroy(&unitReleased);
+	pthread_mutex_destroy(&mutexDispatch);
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every request. Every device gets the number of units given in
+*		configData. Requests are assigned by the dispatch policy of configData, which
+*		draws its random numbers from the seed of configData, if it has one.
+*/
+void DeviceDispatcher::reset(Config configData)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		DispatchUnit unit;
+		unit.outstanding = 0;
+		unit.assigned = 0;
+		unit.maxOutstanding = 0;
+		unit.busy = false;
+		units[i].assign(configData.getDeviceQuant(i), unit);
+	}
+	policy = configData.getDispatchPolicyCode();
+	policyName = configData.getDispatchPolicyName();
+	nextTicket = 0;
+	seed = configData.getRandomSeed() != 0 ? configData.getRandomSeed() : 1;
+	pthread_mutex_unlock(&mutexDispatch);
+
+}
+
+/**
+*	Function: getUnitCount
+*	Description: returns the number of units of device
+*/
+int DeviceDispatcher::getUnitCount(int device)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	int count = units[device].size();
+	pthread_mutex_unlock(&mutexDispatch);
+	
+	return count;
+
+}
+
+/**
+*	Function: setDecisionLog
+*	Description: Records every assignment in source from now on, or replays the
+*		assignments it recorded before. NULL stops recording.
+*/
+void DeviceDispatcher::setDecisionLog(DecisionLog* source)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	decisions = source;
+	pthread_mutex_unlock(&mutexDispatch);
+
+}
+
+/**
+*	Function: assign
+*	Description: Assigns a request of the process with pid process for device to one
+*		of its units and returns the index of that unit. requestCount is how many
+*		requests for device the process made before this one, used by
+*		DISPATCH_PER_PROCESS. A decision log that is replaying picks the unit the
+*		recorded run picked instead of the policy. The unit counts the request as
+*		outstanding until release() is called for it.
+*/
+int DeviceDispatcher::assign(int process, int device, int requestCount)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	int unit = -1;
+	if (decisions != NULL)
+	{
+		unit = decisions->replay(DECISION_ASSIGN, process, device);
+	}
+	if (unit < 0 || unit >= units[device].size())
+	{
+		unit = select(device, requestCount);
+	}
+	if (decisions != NULL)
+	{
+		decisions->record(DECISION_ASSIGN, process, device, unit);
+	}
+	DispatchUnit& chosen = units[device][unit];
+	chosen.assigned++;
+	chosen.outstanding++;
+	if (chosen.outstanding > chosen.maxOutstanding)
+	{
+		chosen.maxOutstanding = chosen.outstanding;
+	}
+	pthread_mutex_unlock(&mutexDispatch);
+	
+	return unit;
+
+}
+
+/**
+*	Function: submit
+*	Description: Assigns a request of process for device like assign(), stores the
+*		unit in unit and queues the request on that unit together with time, the time
+*		(msec) it runs for. Returns the ticket to be handed to acquire() by the thread
+*		that serves the request.
+*/
+long DeviceDispatcher::submit(int process, int device, int requestCount, long time,
+							  int& unit)
+{
+
+	unit = assign(process, device, requestCount);
+	
+	pthread_mutex_lock(&mutexDispatch);
+	long ticket = nextTicket++;
+	units[device][unit].waiting.push_back(make_pair(ticket, time));
+	pthread_mutex_unlock(&mutexDispatch);
+	
+	return ticket;
+
+}
+
+/**
+*	Function: acquire
+*	Description: Blocks until the unit the request with ticket was queued on is free
+*		and every request queued on it before has started, then takes the unit and
+*		stores the time (msec) of the request in time. Returns the index of the unit,
+*		-1 if no request has ticket.
+*/
+int DeviceDispatcher::acquire(long ticket, long& time)
+{
+
+	int device = -1, unit = -1;
+	
+	pthread_mutex_lock(&mutexDispatch);
+	for (int i = 0; unit < 0 && i < DEVICE_COUNT; i++)
+	{
+		for (int j = 0; unit < 0 && j < units[i].size(); j++)
+		{
+			deque<pair<long, long> >& waiting = units[i][j].waiting;
+			for (int k = 0; k < waiting.size(); k++)
+			{
+				if (waiting[k].first == ticket)
+				{
+					device = i;
+					unit = j;
+					time = waiting[k].second;
+					break;
+				}
+			}
+		}
+	}
+	if (unit < 0)
+	{
+		pthread_mutex_unlock(&mutexDispatch);
+		return -1;
+	}
+	
+	DispatchUnit& chosen = units[device][unit];
+	while (chosen.busy || chosen.waiting.front().first != ticket)
+	{
+		pthread_cond_wait(&unitReleased, &mutexDispatch);
+	}
+	chosen.waiting.pop_front();
+	chosen.busy = true;
+	pthread_mutex_unlock(&mutexDispatch);
+	
+	return unit;
+
+}
+
+/**
+*	Function: release
+*	Description: Records that the request on unit of device finished, freeing the
+*		unit for the next request queued on it
+*/
+void DeviceDispatcher::release(int device, int unit)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	units[device][unit].busy = false;
+	units[device][unit].outstanding--;
+	pthread_cond_broadcast(&unitReleased);
+	pthread_mutex_unlock(&mutexDispatch);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the requests assigned to each unit of the hard drives, the
+*		projectors and every other device with more than one unit, their share of the
+*		requests of the device and the most requests a unit held at once to out,
+*		followed by the busiest unit over the mean for each device (1.00 is perfectly
+*		even). Writes nothing if no request was assigned to those devices.
+*/
+void DeviceDispatcher::print(ostream& out)
+{
+
+	char line[160];
+	int total[DEVICE_COUNT] = {0};
+	int requests = 0;
+	
+	pthread_mutex_lock(&mutexDispatch);
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		for (int j = 0; isReported(i) && j < units[i].size(); j++)
+		{
+			total[i] += units[i][j].assigned;
+		}
+		requests += total[i];
+	}
+	if (requests == 0)
+	{
+		pthread_mutex_unlock(&mutexDispatch);
+		return;
+	}
+	
+	out << endl << "Device Dispatch (" << policyName << ")" << endl;
+	snprintf(line, sizeof(line), "%-12s %4s %8s %7s %9s\n", "device", "unit",
+			 "assigned", "share", "max queue");
+	out << line;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		vector<DispatchUnit>& pool = units[i];
+		int busiest = 0;
+		for (int j = 0; total[i] > 0 && j < pool.size(); j++)
+		{
+			snprintf(line, sizeof(line), "%-12s %4d %8d %6.1f%% %9d\n",
+					 Logger::getDeviceName(i), j, pool[j].assigned,
+					 100.0 * pool[j].assigned / total[i], pool[j].maxOutstanding);
+			out << line;
+			if (pool[j].assigned > busiest)
+			{
+				busiest = pool[j].assigned;
+			}
+		}
+		if (total[i] > 0)
+		{
+			snprintf(line, sizeof(line), "%-12s  max/mean %.2f\n",
+					 Logger::getDeviceName(i),
+					 busiest / ((double) total[i] / pool.size()));
+			out << line;
+		}
+	}
+	pthread_mutex_unlock(&mutexDispatch);
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the load and the waiting requests of every unit, the tickets
+*		handed out so far and the state of the random number generator to checkpoint
+*/
+void DeviceDispatcher::save(CheckpointWriter& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		checkpoint.putInt(units[i].size());
+		for (int j = 0; j < units[i].size(); j++)
+		{
+			DispatchUnit& unit = units[i][j];
+			checkpoint.putInt(unit.outstanding);
+			checkpoint.putInt(unit.assigned);
+			checkpoint.putInt(unit.maxOutstanding);
+			checkpoint.putInt(unit.busy);
+			checkpoint.putInt(unit.waiting.size());
+			for (int k = 0; k < unit.waiting.size(); k++)
+			{
+				checkpoint.putInt(unit.waiting[k].first);
+				checkpoint.putInt(unit.waiting[k].second);
+			}
+		}
+	}
+	checkpoint.putInt(nextTicket);
+	checkpoint.putInt(seed);
+	pthread_mutex_unlock(&mutexDispatch);
+
+}
+
+/**
+*	Function: restore
+*	Description: Reads the state written by save() from checkpoint into a dispatcher
+*		reset with as many units of every device. The policy stays the one it was reset
+*		with. Returns false if the checkpoint is not good or the units differ.
+*/
+bool DeviceDispatcher::restore(CheckpointReader& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexDispatch);
+	for (int i = 0; checkpoint.isGood() && i < DEVICE_COUNT; i++)
+	{
+		if (checkpoint.getInt(0, INT_MAX) != units[i].size())
+		{
+			pthread_mutex_unlock(&mutexDispatch);
+			return 0;
+		}
+		for (int j = 0; checkpoint.isGood() && j < units[i].size(); j++)
+		{
+			DispatchUnit& unit = units[i][j];
+			unit.outstanding = checkpoint.getInt(0, INT_MAX);
+			unit.assigned = checkpoint.getInt(0, INT_MAX);
+			unit.maxOutstanding = checkpoint.getInt(0, INT_MAX);
+			unit.busy = checkpoint.getInt(0, 1);
+			unit.waiting.resize(checkpoint.getCount());
+			for (int k = 0; checkpoint.isGood() && k < unit.waiting.size(); k++)
+			{
+				unit.waiting[k].first = checkpoint.getInt(0, LONG_MAX);
+				unit.waiting[k].second = checkpoint.getInt(0, LONG_MAX);
+			}
+		}
+	}
+	nextTicket = checkpoint.getInt(0, LONG_MAX);
+	seed = checkpoint.getInt(0, UINT_MAX);
+	pthread_mutex_unlock(&mutexDispatch);
+	
+	return checkpoint.isGood();
+
+}
+
+/**
+*	Function: select
+*	Description: Returns the unit of device the policy picks for a request that is
+*		the process' request number requestCount. Ties go to the lowest unit, so an
+*		idle unit is the first free one.
+*/
+int DeviceDispatcher::select(int device, int requestCount)
+{
+
+	vector<DispatchUnit>& pool = units[device];
+	int unit = 0;
+	switch (policy)
+	{
+		case DISPATCH_PER_PROCESS:
+			unit = requestCount % pool.size();
+		break;
+		case DISPATCH_SHORTEST_QUEUE:
+			for (int i = 1; i < pool.size(); i++)
+			{
+				if (pool[i].outstanding < pool[unit].outstanding)
+				{
+					unit = i;
+				}
+			}
+		break;
+		case DISPATCH_TWO_CHOICES:
+			//the less loaded of two different units picked at random
+			if (pool.size() > 1)
+			{
+				int first = nextRandom() % pool.size();
+				int second = first + 1 + nextRandom() % (pool.size() - 1);
+				second %= pool.size();
+				unit = pool[second].outstanding < pool[first].outstanding ||
+					   (pool[second].outstanding == pool[first].outstanding &&
+						second < first) ? second : first;
+			}
+		break;
+	}
+	
+	return unit;
+
+}
+
+/**
+*	Function: isReported
+*	Description: returns true if the units of device are written by print(), which
+*		are the hard drives, the projectors and any other pool of several units
+*/
+bool DeviceDispatcher::isReported(int device)
+{
+
+	return device == DEVICE_HARD_DRIVE || device == DEVICE_PROJECTOR ||
+		   units[device].size() > 1;
+
+}
+
+/**
+*	Function: nextRandom
+*	Description: returns the next number of a linear congruential generator, so the
+*		units DISPATCH_TWO_CHOICES compares are the same on every run
+*/
+unsigned int DeviceDispatcher::nextRandom()
+{
+
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) & 0x7fff;
+
+}
@@ -0,0 +1,76 @@
+/**
+*	File Name: DeviceDispatcher.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class DeviceDispatcher. Keeps a pool of
+*		units for every device class, assigns the requests of every process to a unit
+*		by one shared policy and reports how evenly the units were loaded
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef DEVICE_DISPATCHER_
+#define DEVICE_DISPATCHER_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <string>
+#include <pthread.h>
+#include "Config.h"
+#include "Checkpoint.h"
+#include "DecisionLog.h"
+
+using namespace std;
+
+//load of a single unit of a device
+struct DispatchUnit
+{
+	int outstanding; //requests assigned to the unit that have not been released
+	int assigned, maxOutstanding;
+	bool busy;
+	deque<pair<long, long> > waiting; //ticket and time of each request, in order
+};
+
+class DeviceDispatcher
+{
+
+	//DeviceDispatcher class public declarations
+	public:
+	
+		DeviceDispatcher();
+		~DeviceDispatcher();
+	
+		void reset(Config);
+		int getUnitCount(int);
+		void setDecisionLog(DecisionLog*);
+		int assign(int, int, int);
+		long submit(int, int, int, long, int&);
+		int acquire(long, long&);
+		void release(int, int);
+		void print(ostream&);
+		void save(CheckpointWriter&);
+		bool restore(CheckpointReader&);
+	
+	//DeviceDispatcher class private declarations
+	private:
+	
+		int select(int, int);
+		bool isReported(int);
+		unsigned int nextRandom();
+	
+		vector<DispatchUnit> units[DEVICE_COUNT];
+		int policy; //DispatchPolicyCode
+		string policyName;
+		long nextTicket;
+		unsigned int seed; //picks the two units compared by DISPATCH_TWO_CHOICES
+		DecisionLog* decisions; //records or replays every assignment, if not NULL
+	
+		pthread_mutex_t mutexDispatch;
+		pthread_cond_t unitReleased;
+	
+};
+
+#endif
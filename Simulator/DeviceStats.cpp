@@ -0,0 +1,331 @@
+/**
+*	File Name: DeviceStats.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class DeviceStats. Records how busy
+*		each device unit is and how long requests queue for the hard drives,
+*		projectors, keyboard, scanner and monitor during a simulation
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "DeviceStats.h"
+#include <stdio.h>
+#include "Logger.h"
+
+/**
+*	Function: DeviceStats
+*	Description: Default constructor for DeviceStats class
+*/
+DeviceStats::DeviceStats()
+{
+
+	pthread_mutex_init(&mutexStats, NULL);
+	
+	Config configData;
+	configData.setHddQuant(1);
+	configData.setProjQuant(1);
+	reset(configData);
+
+}
+
+/**
+*	Function: ~DeviceStats
+*	Description: Destructor for DeviceStats class
+*/
+DeviceStats::~DeviceStats()
+{
+
+	pthread_mutex_destroy(&mutexStats);
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every measurement. Every device gets the number of units
+*		given in configData.
+*/
+void DeviceStats::reset(Config configData)
+{
+
+	pthread_mutex_lock(&mutexStats);
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		DeviceUnitStats unit = {false, 0, 0, 0};
+		pools[i].units.assign(configData.getDeviceQuant(i), unit);
+		pools[i].requests = 0;
+		pools[i].queueDepth = 0;
+		pools[i].maxQueueDepth = 0;
+		pools[i].queueArea = 0;
+		pools[i].lastChange = 0;
+		pools[i].totalWait = 0;
+		pools[i].maxWait = 0;
+		pools[i].waitHistogram.assign(WAIT_BUCKETS, 0);
+	}
+	samples.clear();
+	pthread_mutex_unlock(&mutexStats);
+
+}
+
+/**
+*	Function: requestArrived
+*	Description: Records that a request for device joined its queue at time now
+*/
+void DeviceStats::requestArrived(int device, double now)
+{
+
+	pthread_mutex_lock(&mutexStats);
+	updateQueue(pools[device], 1, now);
+	pthread_mutex_unlock(&mutexStats);
+
+}
+
+/**
+*	Function: requestStarted
+*	Description: Records that the request for device that arrived at time requested
+*		left the queue and started at time now on unit. If unit is -1 the request is 
+*		given the first idle unit. Returns the index of the unit.
+*/
+int DeviceStats::requestStarted(int device, double now, double requested, int unit)
+{
+
+	DevicePoolStats& pool = pools[device];
+	
+	pthread_mutex_lock(&mutexStats);
+	updateQueue(pool, -1, now);
+	for (int i = 0; unit < 0 && i < pool.units.size(); i++)
+	{
+		if (!pool.units[i].busy)
+		{
+			unit = i;
+			break;
+		}
+	}
+	pool.units[unit].busy = true;
+	pool.units[unit].busyStart = now;
+	
+	double wait = now - requested;
+	int bucket = 0;
+	for (double limit = 0.001; bucket < WAIT_BUCKETS - 1 && wait >= limit; limit *= 2)
+	{
+		bucket++;
+	}
+	pool.waitHistogram[bucket]++;
+	pool.totalWait += wait;
+	if (wait > pool.maxWait)
+	{
+		pool.maxWait = wait;
+	}
+	pool.requests++;
+	pthread_mutex_unlock(&mutexStats);
+	
+	return unit;
+
+}
+
+/**
+*	Function: requestFinished
+*	Description: Records that the request running on unit of device finished at time
+*		now
+*/
+void DeviceStats::requestFinished(int device, int unit, double now)
+{
+
+	pthread_mutex_lock(&mutexStats);
+	DeviceUnitStats& stats = pools[device].units[unit];
+	stats.busy = false;
+	stats.busyTime += now - stats.busyStart;
+	stats.served++;
+	pthread_mutex_unlock(&mutexStats);
+
+}
+
+/**
+*	Function: sample
+*	Description: Stores the number of busy units and queued requests of each device at
+*		time now
+*/
+void DeviceStats::sample(double now)
+{
+
+	DeviceSample current;
+	
+	pthread_mutex_lock(&mutexStats);
+	current.time = now;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		current.busy[i] = 0;
+		for (int j = 0; j < pools[i].units.size(); j++)
+		{
+			if (pools[i].units[j].busy)
+			{
+				current.busy[i]++;
+			}
+		}
+		current.queued[i] = pools[i].queueDepth;
+	}
+	samples.push_back(current);
+	pthread_mutex_unlock(&mutexStats);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the busy time, idle time, utilization and requests served 
+*		(finished) of each unit, the time-weighted mean and maximum queue depth and the wait times
+*		of each device, and any samples taken, to out. programDuration is the length
+*		of the simulation in seconds.
+*/
+void DeviceStats::print(ostream& out, double programDuration)
+{
+
+	char line[160];
+	
+	pthread_mutex_lock(&mutexStats);
+	
+	out << endl << "Device Utilization (seconds)" << endl;
+	snprintf(line, sizeof(line), "%-12s %4s %8s %10s %10s %11s\n", "device", "unit",
+			 "served", "busy", "idle", "utilization");
+	out << line;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		for (int j = 0; isReported(i) && j < pools[i].units.size(); j++)
+		{
+			//a request can still be running when the program ends
+			DeviceUnitStats& unit = pools[i].units[j];
+			double busy = unit.busyTime;
+			if (unit.busy && programDuration > unit.busyStart)
+			{
+				busy += programDuration - unit.busyStart;
+			}
+			double idle = programDuration - busy;
+			snprintf(line, sizeof(line), "%-12s %4d %8d %10.6f %10.6f %10.1f%%\n",
+					 Logger::getDeviceName(i), j, unit.served, busy, idle > 0 ? idle : 0,
+					 programDuration > 0 ? 100 * busy / programDuration : 0.0);
+			out << line;
+		}
+	}
+	
+	out << endl << "Device Queues (seconds)" << endl;
+	snprintf(line, sizeof(line), "%-12s %8s %10s %9s %10s %10s\n", "device", "requests",
+			 "mean depth", "max depth", "mean wait", "max wait");
+	out << line;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		if (isReported(i))
+		{
+			DevicePoolStats& pool = pools[i];
+			updateQueue(pool, 0, programDuration);
+			snprintf(line, sizeof(line), "%-12s %8d %10.4f %9d %10.6f %10.6f\n",
+					 Logger::getDeviceName(i), pool.requests, programDuration > 0 ?
+					 pool.queueArea / programDuration : 0.0, pool.maxQueueDepth,
+					 pool.requests > 0 ? pool.totalWait / pool.requests : 0.0,
+					 pool.maxWait);
+			out << line;
+		}
+	}
+	
+	out << endl << "Device Wait Histogram (requests per wait time)" << endl;
+	snprintf(line, sizeof(line), "%-12s", "device");
+	out << line;
+	for (int i = 0, limit = 1; i < WAIT_BUCKETS; i++, limit *= 2)
+	{
+		char label[16];
+		if (i < WAIT_BUCKETS - 1)
+		{
+			snprintf(label, sizeof(label), "<%d", limit);
+		}
+		else
+		{
+			snprintf(label, sizeof(label), ">=%d", limit / 2);
+		}
+		snprintf(line, sizeof(line), " %7s", label);
+		out << line;
+	}
+	out << " ms" << endl;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		if (isReported(i))
+		{
+			snprintf(line, sizeof(line), "%-12s", Logger::getDeviceName(i));
+			out << line;
+			for (int j = 0; j < WAIT_BUCKETS; j++)
+			{
+				snprintf(line, sizeof(line), " %7d", pools[i].waitHistogram[j]);
+				out << line;
+			}
+			out << endl;
+		}
+	}
+	
+	if (!samples.empty())
+	{
+		out << endl << "Device Samples (busy units/queued requests)" << endl;
+		snprintf(line, sizeof(line), "%10s", "time");
+		out << line;
+		for (int i = 0; i < DEVICE_COUNT; i++)
+		{
+			if (isReported(i))
+			{
+				snprintf(line, sizeof(line), " %11s", Logger::getDeviceName(i));
+				out << line;
+			}
+		}
+		out << endl;
+		for (int i = 0; i < samples.size(); i++)
+		{
+			snprintf(line, sizeof(line), "%10.6f", samples[i].time);
+			out << line;
+			for (int j = 0; j < DEVICE_COUNT; j++)
+			{
+				if (isReported(j))
+				{
+					snprintf(line, sizeof(line), " %5d/%-5d", samples[i].busy[j],
+							 samples[i].queued[j]);
+					out << line;
+				}
+			}
+			out << endl;
+		}
+	}
+	out << endl;
+	
+	pthread_mutex_unlock(&mutexStats);
+
+}
+
+/**
+*	Function: updateQueue
+*	Description: Adds the queue depth of pool since its last change to the time
+*		integral of the depth, then changes the depth by change at time now. Must be
+*		called with mutexStats held.
+*/
+void DeviceStats::updateQueue(DevicePoolStats& pool, int change, double now)
+{
+
+	if (now > pool.lastChange)
+	{
+		pool.queueArea += pool.queueDepth * (now - pool.lastChange);
+		pool.lastChange = now;
+	}
+	pool.queueDepth += change;
+	if (pool.queueDepth > pool.maxQueueDepth)
+	{
+		pool.maxQueueDepth = pool.queueDepth;
+	}
+
+}
+
+/**
+*	Function: isReported
+*	Description: returns true if device is one of the I/O devices whose units and
+*		queues are tracked (hard drive, keyboard, scanner, monitor and projector)
+*/
+bool DeviceStats::isReported(int device)
+{
+
+	return device == DEVICE_HARD_DRIVE || device == DEVICE_KEYBOARD ||
+		   device == DEVICE_SCANNER || device == DEVICE_MONITOR ||
+		   device == DEVICE_PROJECTOR;
+
+}
@@ -0,0 +1,80 @@
+/**
+*	File Name: DeviceStats.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class DeviceStats. Records how busy each
+*		device unit is and how long requests queue for the hard drives, projectors,
+*		keyboard, scanner and monitor during a simulation
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef DEVICE_STATS_
+#define DEVICE_STATS_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <vector>
+#include <pthread.h>
+#include "Config.h"
+
+using namespace std;
+
+//telemetry of a single unit of a device
+struct DeviceUnitStats
+{
+	bool busy;
+	double busyStart, busyTime;
+	int served;
+};
+
+//telemetry of every unit of a device and of the queue in front of them
+struct DevicePoolStats
+{
+	vector<DeviceUnitStats> units;
+	int requests, queueDepth, maxQueueDepth;
+	double queueArea, lastChange; //queue depth integrated over time
+	double totalWait, maxWait;
+	vector<int> waitHistogram; //see DeviceStats::WAIT_BUCKETS
+};
+
+//number of requests queued and units busy for each device at one point in time
+struct DeviceSample
+{
+	double time;
+	int busy[DEVICE_COUNT], queued[DEVICE_COUNT];
+};
+
+class DeviceStats
+{
+
+	//DeviceStats class public declarations
+	public:
+
+		DeviceStats();
+		~DeviceStats();
+
+		void reset(Config);
+		void requestArrived(int, double);
+		int requestStarted(int, double, double, int = -1);
+		void requestFinished(int, int, double);
+		void sample(double);
+		void print(ostream&, double);
+
+		//waits are counted in buckets of under 1, 2, 4, ... 512 ms and 512 ms or more
+		static const int WAIT_BUCKETS = 11;
+
+	//DeviceStats class private declarations
+	private:
+
+		void updateQueue(DevicePoolStats&, int, double);
+		bool isReported(int);
+
+		DevicePoolStats pools[DEVICE_COUNT];
+		vector<DeviceSample> samples;
+		pthread_mutex_t mutexStats;
+
+};
+
+#endif
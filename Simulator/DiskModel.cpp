@@ -0,0 +1,745 @@
+/**
+*	File Name: DiskModel.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class DiskModel. Gives each hard
+*		drive a head position and a queue of requests, served in the order of a disk
+*		scheduling algorithm, and prices each request with its seek, rotational
+*		latency and transfer time
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "DiskModel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+/**
+*	Function: DiskModel
+*	Description: Default constructor for DiskModel class
+*/
+DiskModel::DiskModel()
+{
+
+	pthread_mutex_init(&mutexDisk, NULL);
+	pthread_cond_init(&driveReleased, NULL);
+	reset(Config(), 1);
+
+}
+
+/**
+*	Function: ~DiskModel
+*	Description: Destructor for DiskModel class
+*/
+DiskModel::~DiskModel()
+{
+
+	pthread_cond_destroy(&driveReleased);
+	pthread_mutex_destroy(&mutexDisk);
+
+}
+
+/**
+*	Function: reset
+*	Description: Empties the queues of driveCount drives, parks every head on track 0
+*		and forgets every measurement. The geometry, the scheduling algorithm and the
+*		batching of requests are taken from configData.
+*/
+void DiskModel::reset(Config configData, int driveCount)
+{
+
+	pthread_mutex_lock(&mutexDisk);
+	DiskDrive drive;
+	drive.headTrack = 0;
+	drive.direction = 1;
+	drive.busy = false;
+	drive.chosenTicket = -1;
+	drive.served = 0;
+	drive.batches = 0;
+	drive.merged = 0;
+	drive.tracksMoved = 0;
+	drive.seekTime = 0;
+	drive.rotationTime = 0;
+	drive.totalWait = 0;
+	drive.maxWait = 0;
+	drive.savedTime = 0;
+	drives.assign(driveCount > 0 ? driveCount : 1, drive);
+	
+	nextTicket = 0;
+	scheduleCode = configData.getDiskScheduleCode();
+	scheduleName = configData.getDiskScheduleName();
+	tracks = configData.getDiskTracks();
+	blocksPerTrack = configData.getDiskBlocksPerTrack();
+	trackSeekTime = configData.getDiskTrackSeekTime() / 1000.0;
+	rotationTime = configData.getDiskRotationTime();
+	deadline = configData.getDiskDeadline();
+	batchSize = configData.getDiskBatchSize();
+	batchWindow = configData.getDiskBatchWindow();
+	cycleTime = configData.getHardDriveTime();
+	mergedTickets.clear();
+	timeScale = configData.getTimeScale();
+	clock_gettime(CLOCK_MONOTONIC, &origin);
+	pthread_mutex_unlock(&mutexDisk);
+
+}
+
+/**
+*	Function: submit
+*	Description: Queues a request of process for the block at block (-1 for none) of
+*		drive at time now (msec). operation is kept with the request for the caller.
+*		transferTime is the time (msec) the request takes once the head is in place.
+*		Returns the ticket of the request. Used by callers that keep their own clock
+*		and call start() and finish() themselves.
+*/
+long DiskModel::submit(int drive, int process, int operation, int block,
+					   long transferTime, double now)
+{
+
+	DiskRequest request;
+	request.ticket = nextTicket++;
+	request.process = process;
+	request.operation = operation;
+	request.track = -1;
+	request.sector = -1;
+	if (block >= 0)
+	{
+		request.track = (block / blocksPerTrack) % tracks;
+		request.sector = block % blocksPerTrack;
+	}
+	request.blocks = cycleTime > 0 ? transferTime / cycleTime : 0;
+	request.transferTime = transferTime;
+	request.arrival = now;
+	drives[drive].queue.push_back(request);
+	
+	return request.ticket;
+
+}
+
+/**
+*	Function: readyTime
+*	Description: Returns the time (msec) an idle drive may start a request, once the
+*		batching window of its oldest request has passed, or -1 if drive is busy or
+*		has no requests queued
+*/
+double DiskModel::readyTime(int drive)
+{
+
+	DiskDrive& disk = drives[drive];
+	if (disk.busy || disk.queue.empty())
+	{
+		return -1;
+	}
+	
+	//the queue is in order of arrival
+	return disk.queue.front().arrival + batchWindow;
+
+}
+
+/**
+*	Function: start
+*	Description: If drive is idle and has requests queued, starts the request the
+*		scheduling algorithm picks at time now (msec), stores it in request and the
+*		time (msec) it takes in serviceTime. Returns false if no request was started.
+*/
+bool DiskModel::start(int drive, double now, DiskRequest& request, long& serviceTime)
+{
+
+	DiskDrive& disk = drives[drive];
+	if (disk.busy || disk.queue.empty())
+	{
+		return 0;
+	}
+	
+	begin(disk, selectNext(disk, now), now, request, serviceTime);
+	return 1;
+
+}
+
+/**
+*	Function: finish
+*	Description: Marks the request running on drive as finished and stores the
+*		requests that were merged into it in merged
+*/
+void DiskModel::finish(int drive, vector<DiskRequest>& merged)
+{
+
+	merged.swap(drives[drive].batch);
+	drives[drive].batch.clear();
+	drives[drive].busy = false;
+
+}
+
+/**
+*	Function: submit
+*	Description: Thread safe form of submit() for the simulator, timed by the clock of
+*		the model. Queues a request of process for the block at block (-1 for none) of
+*		drive taking transferTime (msec) once the head is in place and returns its
+*		ticket, to be handed to acquire() by the thread that serves the request.
+*/
+long DiskModel::submit(int drive, int process, int block, long transferTime)
+{
+
+	pthread_mutex_lock(&mutexDisk);
+	long ticket = submit(drive, process, -1, block, transferTime, elapsed());
+	if (!drives[drive].busy && drives[drive].chosenTicket < 0)
+	{
+		choose(drives[drive]);
+	}
+	pthread_mutex_unlock(&mutexDisk);
+	
+	return ticket;
+
+}
+
+/**
+*	Function: acquire
+*	Description: Blocks until the drive the request with ticket was queued for picks
+*		it, then holds the drive until the batching window of its oldest request has
+*		passed, picks again among the requests queued by then and starts it if it is
+*		still the one picked. Stores the drive in drive and returns the time (msec)
+*		the request takes. If the request was merged into the request of another
+*		thread instead, blocks until that one is released, sets merged and returns
+*		0. Returns -1 if no request has ticket.
+*/
+long DiskModel::acquire(long ticket, int& drive, bool& merged)
+{
+
+	long serviceTime = -1;
+	merged = false;
+	
+	pthread_mutex_lock(&mutexDisk);
+	drive = -1;
+	for (int i = 0; drive < 0 && i < drives.size(); i++)
+	{
+		for (int j = 0; j < drives[i].queue.size(); j++)
+		{
+			if (drives[i].queue[j].ticket == ticket)
+			{
+				drive = i;
+				break;
+			}
+		}
+	}
+	if (drive < 0 && mergedTickets.count(ticket))
+	{
+		drive = mergedTickets[ticket].first;
+	}
+	if (drive < 0)
+	{
+		pthread_mutex_unlock(&mutexDisk);
+		return -1;
+	}
+	
+	DiskDrive& disk = drives[drive];
+	while (true)
+	{
+		while (disk.chosenTicket != ticket && !mergedTickets.count(ticket))
+		{
+			pthread_cond_wait(&driveReleased, &mutexDisk);
+		}
+		if (mergedTickets.count(ticket))
+		{
+			while (!mergedTickets[ticket].second)
+			{
+				pthread_cond_wait(&driveReleased, &mutexDisk);
+			}
+			mergedTickets.erase(ticket);
+			merged = true;
+			pthread_mutex_unlock(&mutexDisk);
+			return 0;
+		}
+		
+		//requests arriving while the drive is held may join the operation
+		double ready = disk.queue.front().arrival + batchWindow;
+		bool held = false;
+		while (elapsed() < ready)
+		{
+			struct timespec until;
+			long wait = (long) ((ready - elapsed()) * timeScale * 1000000);
+			clock_gettime(CLOCK_REALTIME, &until);
+			until.tv_sec += (until.tv_nsec + wait) / 1000000000;
+			until.tv_nsec = (until.tv_nsec + wait) % 1000000000;
+			pthread_cond_timedwait(&driveReleased, &mutexDisk, &until);
+			held = true;
+		}
+		
+		//one of them may come first now, in which case it gets the drive and this
+		//request waits for its turn again
+		if (!held)
+		{
+			break;
+		}
+		choose(disk);
+		if (disk.chosenTicket == ticket)
+		{
+			break;
+		}
+	}
+	for (int i = 0; i < disk.queue.size(); i++)
+	{
+		if (disk.queue[i].ticket == ticket)
+		{
+			DiskRequest request;
+			disk.chosenTicket = -1;
+			begin(disk, i, elapsed(), request, serviceTime);
+			break;
+		}
+	}
+	for (int i = 0; i < disk.batch.size(); i++)
+	{
+		mergedTickets[disk.batch[i].ticket] = make_pair(drive, false);
+	}
+	pthread_mutex_unlock(&mutexDisk);
+	
+	return serviceTime;
+
+}
+
+/**
+*	Function: release
+*	Description: Thread safe form of finish() for the simulator. Frees drive and picks
+*		the request it serves next, waking the thread waiting for it and the threads
+*		of the requests merged into the one that finished.
+*/
+void DiskModel::release(int drive)
+{
+
+	pthread_mutex_lock(&mutexDisk);
+	for (int i = 0; i < drives[drive].batch.size(); i++)
+	{
+		mergedTickets[drives[drive].batch[i].ticket].second = true;
+	}
+	drives[drive].batch.clear();
+	drives[drive].busy = false;
+	choose(drives[drive]);
+	pthread_mutex_unlock(&mutexDisk);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the requests each hard drive served, the time they spent on
+*		seeks, rotation and in the queue and how far the head travelled to out. With
+*		batching, also writes the operations that served several requests, the
+*		requests merged into them and the positioning time merging saved. Writes
+*		nothing if no request was served.
+*/
+void DiskModel::print(ostream& out)
+{
+
+	char line[160];
+	int served = 0;
+	
+	pthread_mutex_lock(&mutexDisk);
+	for (int i = 0; i < drives.size(); i++)
+	{
+		served += drives[i].served;
+	}
+	if (served == 0)
+	{
+		pthread_mutex_unlock(&mutexDisk);
+		return;
+	}
+	
+	out << endl << "Hard Drive Scheduling (" << scheduleName << ", msec)" << endl;
+	snprintf(line, sizeof(line), "%5s %8s %9s %9s %9s %9s %12s\n", "drive", "requests",
+			 "mean seek", "mean rot", "mean wait", "max wait", "tracks moved");
+	out << line;
+	for (int i = 0; i < drives.size(); i++)
+	{
+		DiskDrive& disk = drives[i];
+		int count = disk.served > 0 ? disk.served : 1;
+		snprintf(line, sizeof(line), "%5d %8d %9.2f %9.2f %9.2f %9.2f %12ld\n", i,
+				 disk.served, disk.seekTime / count, disk.rotationTime / count,
+				 disk.totalWait / count, disk.maxWait, disk.tracksMoved);
+		out << line;
+	}
+	
+	if (batchSize > 1)
+	{
+		snprintf(line, sizeof(line), "Batching (up to %d requests, %.0f msec window)\n",
+				 batchSize, batchWindow);
+		out << line;
+		snprintf(line, sizeof(line), "%5s %8s %8s %12s\n", "drive", "batches",
+				 "merged", "saved (msec)");
+		out << line;
+		for (int i = 0; i < drives.size(); i++)
+		{
+			snprintf(line, sizeof(line), "%5d %8d %8d %12.2f\n", i, drives[i].batches,
+					 drives[i].merged, drives[i].savedTime);
+			out << line;
+		}
+	}
+	pthread_mutex_unlock(&mutexDisk);
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the queue, head and measurements of every drive and the
+*		tickets handed out so far to checkpoint. The geometry and the algorithm come
+*		from the configuration, so a restored model can serve its queues differently.
+*/
+void DiskModel::save(CheckpointWriter& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexDisk);
+	checkpoint.putInt(drives.size());
+	for (int i = 0; i < drives.size(); i++)
+	{
+		DiskDrive& disk = drives[i];
+		checkpoint.putInt(disk.queue.size());
+		for (int j = 0; j < disk.queue.size(); j++)
+		{
+			saveRequest(checkpoint, disk.queue[j]);
+		}
+		checkpoint.putInt(disk.batch.size());
+		for (int j = 0; j < disk.batch.size(); j++)
+		{
+			saveRequest(checkpoint, disk.batch[j]);
+		}
+		checkpoint.putInt(disk.headTrack);
+		checkpoint.putInt(disk.direction);
+		checkpoint.putInt(disk.busy);
+		checkpoint.putInt(disk.chosenTicket);
+		checkpoint.putInt(disk.served);
+		checkpoint.putInt(disk.batches);
+		checkpoint.putInt(disk.merged);
+		checkpoint.putInt(disk.tracksMoved);
+		checkpoint.putDouble(disk.seekTime);
+		checkpoint.putDouble(disk.rotationTime);
+		checkpoint.putDouble(disk.totalWait);
+		checkpoint.putDouble(disk.maxWait);
+		checkpoint.putDouble(disk.savedTime);
+	}
+	checkpoint.putInt(nextTicket);
+	checkpoint.putInt(mergedTickets.size());
+	map<long, pair<int, bool> >::iterator it;
+	for (it = mergedTickets.begin(); it != mergedTickets.end(); it++)
+	{
+		checkpoint.putInt(it->first);
+		checkpoint.putInt(it->second.first);
+		checkpoint.putInt(it->second.second);
+	}
+	pthread_mutex_unlock(&mutexDisk);
+
+}
+
+/**
+*	Function: restore
+*	Description: Reads the state written by save() from checkpoint into a model reset
+*		with as many drives. Returns false if the checkpoint is not good or was saved
+*		with another number of drives.
+*/
+bool DiskModel::restore(CheckpointReader& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexDisk);
+	if (checkpoint.getInt(0, INT_MAX) != drives.size())
+	{
+		pthread_mutex_unlock(&mutexDisk);
+		return 0;
+	}
+	for (int i = 0; checkpoint.isGood() && i < drives.size(); i++)
+	{
+		DiskDrive& disk = drives[i];
+		disk.queue.resize(checkpoint.getCount());
+		for (int j = 0; checkpoint.isGood() && j < disk.queue.size(); j++)
+		{
+			restoreRequest(checkpoint, disk.queue[j]);
+		}
+		disk.batch.resize(checkpoint.getCount());
+		for (int j = 0; checkpoint.isGood() && j < disk.batch.size(); j++)
+		{
+			restoreRequest(checkpoint, disk.batch[j]);
+		}
+		disk.headTrack = checkpoint.getInt(0, tracks - 1);
+		disk.direction = checkpoint.getInt(-1, 1);
+		disk.busy = checkpoint.getInt(0, 1);
+		disk.chosenTicket = checkpoint.getInt(-1, LONG_MAX);
+		disk.served = checkpoint.getInt(0, INT_MAX);
+		disk.batches = checkpoint.getInt(0, INT_MAX);
+		disk.merged = checkpoint.getInt(0, INT_MAX);
+		disk.tracksMoved = checkpoint.getInt(0, LONG_MAX);
+		disk.seekTime = checkpoint.getDouble();
+		disk.rotationTime = checkpoint.getDouble();
+		disk.totalWait = checkpoint.getDouble();
+		disk.maxWait = checkpoint.getDouble();
+		disk.savedTime = checkpoint.getDouble();
+	}
+	nextTicket = checkpoint.getInt(0, LONG_MAX);
+	mergedTickets.clear();
+	for (long i = checkpoint.getInt(0, INT_MAX); checkpoint.isGood() && i > 0; i--)
+	{
+		long ticket = checkpoint.getInt(0, LONG_MAX);
+		int drive = checkpoint.getInt(0, drives.size() - 1);
+		mergedTickets[ticket] = make_pair(drive, checkpoint.getInt(0, 1) != 0);
+	}
+	pthread_mutex_unlock(&mutexDisk);
+	
+	return checkpoint.isGood();
+
+}
+
+/**
+*	Function: selectNext
+*	Description: Returns the index in the queue of disk of the request the scheduling
+*		algorithm serves next at time now (msec). The queue must not be empty.
+*/
+int DiskModel::selectNext(DiskDrive& disk, double now)
+{
+
+	int next = 0;
+	switch (scheduleCode)
+	{
+		case DISK_SSTF:
+			next = findNearest(disk, 0);
+		break;
+		case DISK_SCAN:
+			//sweeps one way, then turns around when nothing is left ahead of the head
+			next = findNearest(disk, disk.direction);
+			if (next < 0)
+			{
+				next = findNearest(disk, -disk.direction);
+			}
+		break;
+		case DISK_DEADLINE:
+			//the queue is in order of arrival, so the front has waited the longest
+			if (now - disk.queue.front().arrival >= deadline)
+			{
+				next = 0;
+				break;
+			}
+		//fall through: otherwise served like C-LOOK
+		case DISK_CLOOK:
+			//sweeps towards higher tracks only, then jumps back to the lowest request
+			next = findNearest(disk, 1);
+			if (next < 0)
+			{
+				next = 0;
+				for (int i = 1; i < disk.queue.size(); i++)
+				{
+					if (disk.queue[i].track < disk.queue[next].track)
+					{
+						next = i;
+					}
+				}
+			}
+		break;
+	}
+	
+	return next;
+
+}
+
+/**
+*	Function: findNearest
+*	Description: Returns the index in the queue of disk of the request closest to the
+*		head that lies in direction (1 for higher tracks, -1 for lower tracks, 0 for
+*		either), the earliest of them on a tie. A request without a block lies under
+*		the head. Returns -1 if there is none.
+*/
+int DiskModel::findNearest(DiskDrive& disk, int direction)
+{
+
+	int nearest = -1;
+	long nearestDistance = 0;
+	for (int i = 0; i < disk.queue.size(); i++)
+	{
+		long track = disk.queue[i].track >= 0 ? disk.queue[i].track : disk.headTrack;
+		long offset = track - disk.headTrack;
+		if (offset * direction < 0)
+		{
+			continue;
+		}
+		if (nearest < 0 || labs(offset) < nearestDistance)
+		{
+			nearest = i;
+			nearestDistance = labs(offset);
+		}
+	}
+	
+	return nearest;
+
+}
+
+/**
+*	Function: begin
+*	Description: Takes the request at index out of the queue of disk, stores it in
+*		request and starts it at time now (msec). The head seeks to its track and
+*		waits for its sector to turn under it, then the transfer runs; serviceTime
+*		gets the sum of the three (msec). Up to batchSize - 1 queued requests that
+*		follow on from it are merged into the operation, see the drive's batch.
+*/
+void DiskModel::begin(DiskDrive& disk, int index, double now, DiskRequest& request,
+					  long& serviceTime)
+{
+
+	request = disk.queue[index];
+	disk.queue.erase(disk.queue.begin() + index);
+	
+	long headStart = disk.headTrack;
+	long target = request.track >= 0 ? request.track : disk.headTrack;
+	long distance = labs(target - disk.headTrack);
+	if (scheduleCode == DISK_SCAN && (target - disk.headTrack) * disk.direction < 0)
+	{
+		//SCAN runs on to the last track before it turns around
+		long edge = disk.direction > 0 ? tracks - 1 : 0;
+		distance = labs(edge - disk.headTrack) + labs(edge - target);
+		disk.direction = -disk.direction;
+	}
+	double seek = distance * trackSeekTime;
+	
+	//the platter keeps turning while the head seeks
+	double rotation = rotationDelay(request.sector, now + seek);
+	serviceTime = request.transferTime + (long) (seek + rotation + 0.5);
+	
+	double wait = now - request.arrival;
+	disk.headTrack = target;
+	disk.busy = true;
+	disk.served++;
+	disk.tracksMoved += distance;
+	disk.seekTime += seek;
+	disk.rotationTime += rotation;
+	disk.totalWait += wait;
+	if (wait > disk.maxWait)
+	{
+		disk.maxWait = wait;
+	}
+	
+	//the blocks right after the request, and requests of the same process that need
+	//no seek, are served by the same operation without positioning the head again
+	disk.batch.clear();
+	long nextSector = request.sector >= 0 ? request.sector + request.blocks : -1;
+	double position = now + seek + rotation + request.transferTime;
+	for (int i = 0; i < disk.queue.size() && disk.batch.size() + 1 < batchSize; )
+	{
+		DiskRequest next = disk.queue[i];
+		bool adjacent = next.track == target && next.sector >= 0 &&
+						next.sector == nextSector;
+		bool sameProcess = next.process == request.process &&
+						   (next.track < 0 || next.track == target);
+		if (!adjacent && !sameProcess)
+		{
+			i++;
+			continue;
+		}
+		disk.queue.erase(disk.queue.begin() + i);
+		
+		//on its own the request would have needed the head positioned once more
+		double delay = adjacent ? 0 : rotationDelay(next.sector, position);
+		long alone = labs((next.track >= 0 ? next.track : target) - headStart);
+		double aloneSeek = alone * trackSeekTime;
+		disk.savedTime += aloneSeek + rotationDelay(next.sector, now + aloneSeek) - delay;
+		disk.rotationTime += delay;
+		serviceTime += next.transferTime + (long) (delay + 0.5);
+		position += delay + next.transferTime;
+		if (next.sector >= 0)
+		{
+			nextSector = next.sector + next.blocks;
+		}
+		
+		wait = now - next.arrival;
+		disk.served++;
+		disk.merged++;
+		disk.totalWait += wait;
+		if (wait > disk.maxWait)
+		{
+			disk.maxWait = wait;
+		}
+		disk.batch.push_back(next);
+	}
+	if (!disk.batch.empty())
+	{
+		disk.batches++;
+	}
+
+}
+
+/**
+*	Function: rotationDelay
+*	Description: Returns the time (msec) the head waits at time (msec) for sector to
+*		turn under it, 0 for a request without a block or a drive without rotation
+*/
+double DiskModel::rotationDelay(long sector, double time)
+{
+
+	if (sector < 0 || rotationTime <= 0)
+	{
+		return 0;
+	}
+	
+	double angle = fmod(time, rotationTime) / rotationTime;
+	double sectorAngle = sector / (double) blocksPerTrack;
+	return fmod(sectorAngle - angle + 1, 1.0) * rotationTime;
+
+}
+
+/**
+*	Function: choose
+*	Description: Picks the request an idle disk serves next and wakes the threads
+*		waiting in acquire() so the thread of that request can start it
+*/
+void DiskModel::choose(DiskDrive& disk)
+{
+
+	disk.chosenTicket = -1;
+	if (!disk.queue.empty())
+	{
+		disk.chosenTicket = disk.queue[selectNext(disk, elapsed())].ticket;
+	}
+	pthread_cond_broadcast(&driveReleased);
+
+}
+
+/**
+*	Function: saveRequest
+*	Description: Writes every field of request to checkpoint
+*/
+void DiskModel::saveRequest(CheckpointWriter& checkpoint, const DiskRequest& request)
+{
+
+	checkpoint.putInt(request.ticket);
+	checkpoint.putInt(request.process);
+	checkpoint.putInt(request.operation);
+	checkpoint.putInt(request.track);
+	checkpoint.putInt(request.sector);
+	checkpoint.putInt(request.blocks);
+	checkpoint.putInt(request.transferTime);
+	checkpoint.putDouble(request.arrival);
+
+}
+
+/**
+*	Function: restoreRequest
+*	Description: Reads a request written by saveRequest() from checkpoint into request
+*/
+void DiskModel::restoreRequest(CheckpointReader& checkpoint, DiskRequest& request)
+{
+
+	request.ticket = checkpoint.getInt(0, LONG_MAX);
+	request.process = checkpoint.getInt(INT_MIN, INT_MAX);
+	request.operation = checkpoint.getInt(INT_MIN, INT_MAX);
+	request.track = checkpoint.getInt(-1, tracks - 1);
+	request.sector = checkpoint.getInt(-1, blocksPerTrack - 1);
+	request.blocks = checkpoint.getInt(0, LONG_MAX);
+	request.transferTime = checkpoint.getInt(0, LONG_MAX);
+	request.arrival = checkpoint.getDouble();
+
+}
+
+/**
+*	Function: elapsed
+*	Description: returns the simulated milliseconds since the model was last reset
+*/
+double DiskModel::elapsed()
+{
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - origin.tv_sec) * 1000.0 +
+			(now.tv_nsec - origin.tv_nsec) / 1000000.0) / timeScale;
+
+}
@@ -0,0 +1,107 @@
+/**
+*	File Name: DiskModel.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class DiskModel. Gives each hard drive a head
+*		position and a queue of requests, served in the order of a disk scheduling
+*		algorithm, and prices each request with its seek, rotational latency and
+*		transfer time
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef DISK_MODEL_
+#define DISK_MODEL_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <map>
+#include <pthread.h>
+#include <time.h>
+#include "Config.h"
+#include "Checkpoint.h"
+
+using namespace std;
+
+//one request queued for a hard drive
+struct DiskRequest
+{
+	long ticket; //handed out by submit() in the order requests arrive
+	int process, operation; //what the request belongs to, for the caller
+	long track, sector; //-1 if the request names no block
+	long blocks; //blocks moved, the transfer time over the cycle time of the drive
+	long transferTime; //msec, the cycle time of the drive times the cycles
+	double arrival; //msec
+};
+
+//state and telemetry of a single hard drive
+struct DiskDrive
+{
+	deque<DiskRequest> queue;
+	long headTrack;
+	int direction; //1 while the head sweeps towards higher tracks, -1 otherwise
+	bool busy;
+	long chosenTicket; //request to be served next by acquire(), -1 if none
+	vector<DiskRequest> batch; //requests merged into the running request
+	int served, batches, merged;
+	long tracksMoved;
+	double seekTime, rotationTime, totalWait, maxWait, savedTime; //msec
+};
+
+class DiskModel
+{
+
+	//DiskModel class public declarations
+	public:
+	
+		DiskModel();
+		~DiskModel();
+	
+		void reset(Config, int);
+	
+		long submit(int, int, int, int, long, double);
+		double readyTime(int);
+		bool start(int, double, DiskRequest&, long&);
+		void finish(int, vector<DiskRequest>&);
+	
+		long submit(int, int, int, long);
+		long acquire(long, int&, bool&);
+		void release(int);
+	
+		void print(ostream&);
+		void save(CheckpointWriter&);
+		bool restore(CheckpointReader&);
+	
+	//DiskModel class private declarations
+	private:
+	
+		int selectNext(DiskDrive&, double);
+		int findNearest(DiskDrive&, int);
+		void begin(DiskDrive&, int, double, DiskRequest&, long&);
+		double rotationDelay(long, double);
+		void choose(DiskDrive&);
+		void saveRequest(CheckpointWriter&, const DiskRequest&);
+		void restoreRequest(CheckpointReader&, DiskRequest&);
+		double elapsed();
+	
+		vector<DiskDrive> drives;
+		long nextTicket;
+		int scheduleCode;
+		string scheduleName;
+		long tracks, blocksPerTrack;
+		double trackSeekTime, rotationTime, deadline; //msec
+		int batchSize, cycleTime;
+		double batchWindow; //msec
+		map<long, pair<int, bool> > mergedTickets; //drive, and if its batch finished
+		struct timespec origin; //start of the clock used by the blocking functions
+		double timeScale; //real time per unit of simulated time
+	
+		pthread_mutex_t mutexDisk;
+		pthread_cond_t driveReleased;
+	
+};
+
+#endif
@@ -0,0 +1,1403 @@
+/**
+*	File Name: EventEngine.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class EventEngine. A discrete-event
+*		model of the simulator that runs a program under a scheduling policy on a
+*		virtual clock, so runs are deterministic and take no real time. Runs without
+*		preemption or contention are worked out in closed form.
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "EventEngine.h"
+#include <algorithm>
+#include <math.h>
+#include <limits.h>
+
+/**
+*	Function: EventEngine
+*	Description: Parameterized constructor for EventEngine class with parameter
+*		configSource used as the configuration (device times and quantities,
+*		scheduling code and quantum) of every run
+*/
+EventEngine::EventEngine(Config configSource)
+{
+
+	configData = configSource;
+	now = 0;
+	sequence = 0;
+	token = 0;
+	quantum = 0;
+	cpuBusyTime = 0;
+	operationStart = 0;
+	interruptReturn = -1;
+	running = -1;
+	lastRunning = -1;
+	contextSwitches = 0;
+	preemptions = 0;
+	preemptPending = false;
+	fastPath = true;
+	evaluatedSequence = 0;
+
+}
+
+/**
+*	Function: addSink
+*	Description: Adds sink to the sinks that receive an event, stamped with virtual
+*		time, for everything that happens during a run
+*/
+void EventEngine::addSink(EventSink* sink)
+{
+
+	sinks.push_back(sink);
+
+}
+
+/**
+*	Function: load
+*	Description: Splits instructionSet, whose total times have been calculated, into
+*		processes at each A{begin} and orders their arrival the way prepProgram() does
+*		for the scheduling code: PS loads the processes with the most I/O operations
+*		first, SJF the processes with the fewest operations first. Returns the number
+*		of processes.
+*/
+int EventEngine::load(deque<MetaData> instructionSet)
+{
+
+	processes.clear();
+	arrivalOrder.clear();
+	
+	for (int i = 0; i < instructionSet.size(); i++)
+	{
+		char code = instructionSet[i].getCode();
+		string descriptor = instructionSet[i].getDescriptor();
+		if (code == 'A' && descriptor == "begin")
+		{
+			EngineProcess process;
+			process.pid = processes.size() + 1;
+			process.next = 0;
+			process.remaining = 0;
+			process.estimatedRemaining = 0;
+			process.ioCount = 0;
+			process.started = false;
+			processes.push_back(process);
+			continue;
+		}
+		if (code == 'S' || code == 'A' || processes.empty())
+		{
+			continue;
+		}
+	
+		Operation operation;
+		operation.device = MetaData::lookupDeviceId(code, descriptor);
+		operation.time = instructionSet[i].getTotalTime();
+		operation.block = instructionSet[i].getBlockAddress();
+		operation.cycles = instructionSet[i].getNumOfCycles();
+		if (code == 'P')
+		{
+			operation.startEvent = EVENT_PROCESSING_START;
+			operation.endEvent = EVENT_PROCESSING_END;
+		}
+		else if (code == 'M' && descriptor == "block")
+		{
+			operation.startEvent = EVENT_MEMORY_BLOCK_START;
+			operation.endEvent = EVENT_MEMORY_BLOCK_END;
+		}
+		else if (code == 'M')
+		{
+			operation.startEvent = EVENT_MEMORY_ALLOCATE_START;
+			operation.endEvent = EVENT_MEMORY_ALLOCATE_END;
+		}
+		else if (code == 'I')
+		{
+			operation.startEvent = EVENT_INPUT_START;
+			operation.endEvent = EVENT_INPUT_END;
+		}
+		else
+		{
+			operation.startEvent = EVENT_OUTPUT_START;
+			operation.endEvent = EVENT_OUTPUT_END;
+		}
+	
+		EngineProcess& process = processes.back();
+		process.operations.push_back(operation);
+		process.estimatedRemaining += operation.time;
+		if (code == 'I' || code == 'O')
+		{
+			process.ioCount++;
+		}
+	}
+	
+	//selection sort, like the schedulers of the simulator, keeping ties in file order
+	vector<bool> placed(processes.size(), false);
+	for (int i = 0; i < processes.size(); i++)
+	{
+		int best = -1;
+		for (int j = 0; j < processes.size(); j++)
+		{
+			if (placed[j])
+			{
+				continue;
+			}
+			if (best < 0 ||
+				(configData.getCpuScheduleCode() == 1 &&
+				 processes[j].ioCount > processes[best].ioCount) ||
+				(configData.getCpuScheduleCode() == 2 &&
+				 processes[j].operations.size() < processes[best].operations.size()))
+			{
+				best = j;
+			}
+		}
+		placed[best] = true;
+		arrivalOrder.push_back(best);
+	}
+	
+	return processes.size();
+
+}
+
+/**
+*	Function: run
+*	Description: Runs the loaded program to completion on the virtual clock and stores
+*		the makespan, throughput, context switches and utilization in result. The run
+*		is worked out by evaluate() instead when it can be and the fast path is on.
+*		Returns false if no program was loaded.
+*/
+bool EventEngine::run(EngineResult& result)
+{
+
+	if (fastPath && evaluate(result))
+	{
+		flushEvaluation();
+		return 1;
+	}
+	
+	if (!start())
+	{
+		return 0;
+	}
+	finish(result);
+	return 1;
+
+}
+
+/**
+*	Function: setFastPath
+*	Description: sets whether run() tries evaluate() before simulating to source, on
+*		by default
+*/
+void EventEngine::setFastPath(bool source)
+{
+
+	fastPath = source;
+
+}
+
+/**
+*	Function: evaluate
+*	Description: Works out the run of the loaded program in one pass instead of
+*		simulating it, when nothing can happen out of turn: FIFO, PS or SJF, where a
+*		process keeps the processor until it ends, with devices that take exactly
+*		their cycle time (no seek, rotation, batching window, cache or interrupt
+*		handler) and no request waiting for a busy unit. The processor then runs one
+*		operation after another, an operation ending where the next starts, and
+*		every I/O operation ends a fixed time after it was issued. Stores the same
+*		result as finish() and keeps the events, in the order the simulation logs
+*		them, for flushEvaluation(). Returns false, with nothing kept, if the run has
+*		to be simulated.
+*/
+bool EventEngine::evaluate(EngineResult& result)
+{
+
+	int code = configData.getCpuScheduleCode();
+	evaluation.clear();
+	if (processes.empty() || (code != 0 && code != 1 && code != 2) ||
+		configData.getDiskTrackSeekTime() > 0 || configData.getDiskRotationTime() > 0 ||
+		configData.getDiskBatchWindow() > 0 || configData.getCacheSize() > 0 ||
+		configData.getInterruptHandlerTime() > 0 ||
+		configData.getInterruptCoalesceCount() > 1)
+	{
+		return 0;
+	}
+	
+	reset();
+	evaluatedNext.assign(processes.size(), 0);
+	for (int i = 0; i < processes.size(); i++)
+	{
+		fill(processes[i].devicesUsed, processes[i].devicesUsed + DEVICE_COUNT, 0);
+	}
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		evaluatedDevices[i] = priority_queue<Event, vector<Event>, greater<Event> >();
+	}
+	evaluatedOperation.time = -1;
+	
+	//the arrivals are the first events start() schedules
+	sequence = arrivalOrder.size();
+	int arrived = 0;
+	bool okToContinue = true;
+	while (okToContinue &&
+		   (arrived < arrivalOrder.size() || evaluatedOperation.time >= 0))
+	{
+		//an arrival at the time an operation ends comes first, its sequence is lower
+		if (arrived < arrivalOrder.size() && (evaluatedOperation.time < 0 ||
+			arrived * ARRIVAL_INTERVAL <= evaluatedOperation.time))
+		{
+			now = arrived * ARRIVAL_INTERVAL;
+			evaluatedSequence = arrived;
+			int index = arrivalOrder[arrived++];
+			note(EVENT_PROCESS_ARRIVE, index);
+			readyQueue.push_back(index);
+			if (running < 0)
+			{
+				okToContinue = evaluateDispatch();
+			}
+			continue;
+		}
+	
+		now = evaluatedOperation.time;
+		evaluatedSequence = evaluatedOperation.sequence;
+		evaluatedOperation.time = -1;
+		Operation& operation = processes[running].operations[evaluatedNext[running]++];
+		cpuBusyTime += now - operationStart;
+		note(operation.endEvent, running, operation.device);
+		okToContinue = evaluateProcess();
+	}
+	if (!okToContinue)
+	{
+		evaluation.clear();
+		return 0;
+	}
+	
+	stable_sort(evaluation.begin(), evaluation.end());
+	now = evaluation.back().time;
+	getResult(result);
+	return 1;
+
+}
+
+/**
+*	Function: flushEvaluation
+*	Description: Hands the events kept by the last evaluate() to every sink, stamped
+*		with their virtual time, as the simulation of the run would have
+*/
+void EventEngine::flushEvaluation()
+{
+
+	for (int i = 0; i < evaluation.size(); i++)
+	{
+		EvaluatedEvent& event = evaluation[i];
+		now = event.time;
+		log(event.type, event.index, event.device, event.unit);
+	}
+	evaluation.clear();
+
+}
+
+/**
+*	Function: start
+*	Description: Puts the loaded program at virtual time 0, with every process still
+*		to arrive, for runUntil() and finish() to run. Returns false if no program was
+*		loaded.
+*/
+bool EventEngine::start()
+{
+
+	if (processes.empty())
+	{
+		cout << "ERROR: No processes loaded into the event engine" << endl;
+		return 0;
+	}
+	
+	reset();
+	for (int i = 0; i < processes.size(); i++)
+	{
+		fill(processes[i].devicesUsed, processes[i].devicesUsed + DEVICE_COUNT, 0);
+	}
+	for (int i = 0; i < arrivalOrder.size(); i++)
+	{
+		schedule(i * ARRIVAL_INTERVAL, ENGINE_ARRIVAL, arrivalOrder[i]);
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: runUntil
+*	Description: Runs the started program until every event up to virtual time
+*		stopTime (msec) has happened, so it can be checkpointed there. Returns true if
+*		nothing is left to happen.
+*/
+bool EventEngine::runUntil(long stopTime)
+{
+
+	while (!events.empty() || !completions.empty())
+	{
+		//completions still held back once nothing else can happen are delivered
+		if (events.empty())
+		{
+			deliverInterrupt();
+			continue;
+		}
+		if (events.top().time > stopTime)
+		{
+			return 0;
+		}
+		
+		Event event = events.top();
+		events.pop();
+		now = event.time;
+	
+		switch (event.type)
+		{
+			case ENGINE_ARRIVAL:
+				arrive(event.pid);
+			break;
+			case ENGINE_OPERATION_DONE:
+				if (event.token == token)
+				{
+					finishOperation();
+				}
+			break;
+			case ENGINE_QUANTUM:
+				if (event.token == token && running >= 0)
+				{
+					if (!readyQueue.empty())
+					{
+						requestPreempt();
+					}
+					else
+					{
+						schedule(now + quantum, ENGINE_QUANTUM, running);
+					}
+				}
+			break;
+			case ENGINE_DEVICE_DONE:
+				finishDevice(event);
+			break;
+			case ENGINE_INTERRUPT_TIMER:
+				if (interrupts.deadline() >= 0 && now >= interrupts.deadline())
+				{
+					deliverInterrupt();
+				}
+			break;
+			case ENGINE_INTERRUPT_RETURN:
+				if (event.token == token)
+				{
+					returnFromInterrupt();
+				}
+			break;
+			case ENGINE_CACHE_DONE:
+				log(processes[event.pid].operations[event.operation].endEvent,
+					event.pid, DEVICE_HARD_DRIVE);
+			break;
+			case ENGINE_DISK_READY:
+				startDisk(event.unit);
+			break;
+		}
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: finish
+*	Description: Runs the started or restored program to completion and stores the
+*		makespan, throughput, context switches and utilization in result
+*/
+void EventEngine::finish(EngineResult& result)
+{
+
+	runUntil(LONG_MAX);
+	getResult(result);
+
+}
+
+/**
+*	Function: getResult
+*	Description: Stores the makespan, throughput, context switches and utilization of
+*		the run that ended at the current virtual time in result
+*/
+void EventEngine::getResult(EngineResult& result)
+{
+
+	result.processCount = processes.size();
+	result.contextSwitches = contextSwitches;
+	result.preemptions = preemptions;
+	result.makespan = now;
+	result.throughput = now > 0 ? processes.size() / (now / 1000.0) : 0;
+	result.cpuUtilization = now > 0 ? cpuBusyTime / (double) now : 0;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		result.deviceUtilization[i] = now > 0 ? pools[i].busyTime /
+									  (double) (now * pools[i].busy.size()) : 0;
+	}
+
+}
+
+/**
+*	Function: saveCheckpoint
+*	Description: Writes everything a run depends on at the current virtual time to
+*		out as a binary checkpoint (see CheckpointWriter): the clock, the processes
+*		and their progress, the pending events, the ready queue, the queues of every
+*		device unit and the state of the disk, dispatcher, cache and interrupt models.
+*		The configuration and the sinks are not saved. Returns false if it could not
+*		be written.
+*/
+bool EventEngine::saveCheckpoint(ostream& out)
+{
+
+	CheckpointWriter checkpoint(out);
+	long values[] = {now, sequence, token, cpuBusyTime, operationStart,
+					 interruptReturn, (long) processes.size(), running, lastRunning,
+					 contextSwitches, preemptions, preemptPending};
+	for (int i = 0; i < 12; i++)
+	{
+		checkpoint.putInt(values[i]);
+	}
+	
+	for (int i = 0; i < processes.size(); i++)
+	{
+		EngineProcess& process = processes[i];
+		checkpoint.putInt(process.operations.size());
+		for (int j = 0; j < process.operations.size(); j++)
+		{
+			Operation& operation = process.operations[j];
+			checkpoint.putInt(operation.device);
+			checkpoint.putInt(operation.startEvent);
+			checkpoint.putInt(operation.endEvent);
+			checkpoint.putInt(operation.time);
+			checkpoint.putInt(operation.block);
+			checkpoint.putInt(operation.cycles);
+		}
+		checkpoint.putInt(process.next);
+		checkpoint.putInt(process.remaining);
+		checkpoint.putInt(process.estimatedRemaining);
+		checkpoint.putInt(process.ioCount);
+		for (int j = 0; j < DEVICE_COUNT; j++)
+		{
+			checkpoint.putInt(process.devicesUsed[j]);
+		}
+		checkpoint.putInt(process.started);
+		checkpoint.putInt(arrivalOrder[i]);
+	}
+	
+	//in the order they happen, so they are scheduled again in that order
+	priority_queue<Event, vector<Event>, greater<Event> > pending = events;
+	checkpoint.putInt(pending.size());
+	for (; !pending.empty(); pending.pop())
+	{
+		saveEvent(checkpoint, pending.top());
+	}
+	checkpoint.putInt(completions.size());
+	for (int i = 0; i < completions.size(); i++)
+	{
+		checkpoint.putInt(completions[i].pid);
+		checkpoint.putInt(completions[i].operation);
+		checkpoint.putInt(completions[i].device);
+		checkpoint.putInt(completions[i].unit);
+	}
+	checkpoint.putInt(readyQueue.size());
+	for (int i = 0; i < readyQueue.size(); i++)
+	{
+		checkpoint.putInt(readyQueue[i]);
+	}
+	
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		DevicePool& pool = pools[i];
+		checkpoint.putInt(pool.busy.size());
+		for (int j = 0; j < pool.busy.size(); j++)
+		{
+			checkpoint.putInt(pool.busy[j]);
+			checkpoint.putInt(pool.waiting[j].size());
+			for (int k = 0; k < pool.waiting[j].size(); k++)
+			{
+				checkpoint.putInt(pool.waiting[j][k].first);
+				checkpoint.putInt(pool.waiting[j][k].second);
+			}
+		}
+		checkpoint.putInt(pool.busyTime);
+	}
+	
+	disk.save(checkpoint);
+	dispatcher.save(checkpoint);
+	cache.save(checkpoint);
+	interrupts.save(checkpoint);
+	
+	if (!checkpoint.isGood())
+	{
+		cout << "ERROR: Checkpoint could not be written" << endl;
+		return 0;
+	}
+	return 1;
+
+}
+
+/**
+*	Function: restoreCheckpoint
+*	Description: Replaces the program and the state of the engine with the checkpoint
+*		in in, written by saveCheckpoint(), so finish() carries on from its virtual
+*		time. The device quantities and the cache size have to be the ones the
+*		checkpoint was saved with; the scheduling, disk and dispatch policies and
+*		the coalescing of interrupts may differ, so one warmed up run can be forked
+*		under each of them. Returns false if the checkpoint could not be read.
+*/
+bool EventEngine::restoreCheckpoint(istream& in)
+{
+
+	CheckpointReader checkpoint(in);
+	reset();
+	now = checkpoint.getInt(0, LONG_MAX);
+	sequence = checkpoint.getInt(0, LONG_MAX);
+	token = checkpoint.getInt(0, LONG_MAX);
+	cpuBusyTime = checkpoint.getInt(0, LONG_MAX);
+	operationStart = checkpoint.getInt(0, LONG_MAX);
+	interruptReturn = checkpoint.getInt(-1, LONG_MAX);
+	
+	int count = checkpoint.getInt(1, INT_MAX);
+	running = checkpoint.getInt(-1, count - 1);
+	lastRunning = checkpoint.getInt(-1, count - 1);
+	contextSwitches = checkpoint.getInt(0, INT_MAX);
+	preemptions = checkpoint.getInt(0, INT_MAX);
+	preemptPending = checkpoint.getInt(0, 1);
+	
+	processes.clear();
+	arrivalOrder.clear();
+	for (int i = 0; checkpoint.isGood() && i < count; i++)
+	{
+		EngineProcess process;
+		process.pid = i + 1;
+		process.operations.resize(checkpoint.getCount());
+		for (int j = 0; checkpoint.isGood() && j < process.operations.size(); j++)
+		{
+			Operation& operation = process.operations[j];
+			operation.device = checkpoint.getInt(0, DEVICE_COUNT - 1);
+			operation.startEvent = checkpoint.getInt(0, EVENT_TYPE_COUNT - 1);
+			operation.endEvent = checkpoint.getInt(0, EVENT_TYPE_COUNT - 1);
+			operation.time = checkpoint.getInt(0, LONG_MAX);
+			operation.block = checkpoint.getInt(-1, INT_MAX);
+			operation.cycles = checkpoint.getInt(0, INT_MAX);
+		}
+		process.next = checkpoint.getInt(0, process.operations.size());
+		process.remaining = checkpoint.getInt(0, LONG_MAX);
+		process.estimatedRemaining = checkpoint.getInt(LONG_MIN, LONG_MAX);
+		process.ioCount = checkpoint.getInt(0, INT_MAX);
+		for (int j = 0; j < DEVICE_COUNT; j++)
+		{
+			process.devicesUsed[j] = checkpoint.getInt(0, INT_MAX);
+		}
+		process.started = checkpoint.getInt(0, 1);
+		processes.push_back(process);
+		arrivalOrder.push_back(checkpoint.getInt(0, count - 1));
+	}
+	
+	for (long i = checkpoint.getInt(0, INT_MAX); checkpoint.isGood() && i > 0; i--)
+	{
+		Event event;
+		restoreEvent(checkpoint, event);
+		events.push(event);
+	}
+	completions.resize(checkpoint.getCount());
+	for (int i = 0; checkpoint.isGood() && i < completions.size(); i++)
+	{
+		completions[i].pid = checkpoint.getInt(0, count - 1);
+		completions[i].operation = checkpoint.getInt(0, checkpoint.isGood() ?
+			(long) processes[completions[i].pid].operations.size() - 1 : 0);
+		completions[i].device = checkpoint.getInt(0, DEVICE_COUNT - 1);
+		completions[i].unit = checkpoint.getInt(0, (long) pools[completions[i].device]
+												.busy.size() - 1);
+	}
+	readyQueue.resize(checkpoint.getCount());
+	for (int i = 0; checkpoint.isGood() && i < readyQueue.size(); i++)
+	{
+		readyQueue[i] = checkpoint.getInt(0, count - 1);
+	}
+	
+	bool matches = true;
+	for (int i = 0; checkpoint.isGood() && i < DEVICE_COUNT; i++)
+	{
+		DevicePool& pool = pools[i];
+		matches = matches && checkpoint.getInt(0, INT_MAX) == pool.busy.size();
+		for (int j = 0; matches && checkpoint.isGood() && j < pool.busy.size(); j++)
+		{
+			pool.busy[j] = checkpoint.getInt(0, 1);
+			for (long k = checkpoint.getInt(0, INT_MAX); checkpoint.isGood() && k > 0;
+				 k--)
+			{
+				int index = checkpoint.getInt(0, (long) processes.size() - 1);
+				int operation = checkpoint.getInt(0, checkpoint.isGood() ?
+					(long) processes[index].operations.size() - 1 : 0);
+				pool.waiting[j].push_back(make_pair(index, operation));
+			}
+		}
+		pool.busyTime = checkpoint.getInt(0, LONG_MAX);
+	}
+	
+	matches = matches && disk.restore(checkpoint) && dispatcher.restore(checkpoint) &&
+			  cache.restore(checkpoint) && interrupts.restore(checkpoint);
+	if (!matches && checkpoint.isGood())
+	{
+		cout << "ERROR: Checkpoint was saved with other device quantities or cache "
+			 << "size" << endl;
+		processes.clear();
+		return 0;
+	}
+	if (!checkpoint.isGood())
+	{
+		cout << "ERROR: Checkpoint could not be read" << endl;
+		processes.clear();
+		return 0;
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: reset
+*	Description: Empties the event queue, the ready queue and every device, resets
+*		the models from the configuration and turns the clock back to 0
+*/
+void EventEngine::reset()
+{
+
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		int units = configData.getDeviceQuant(i);
+		pools[i].busy.assign(units, false);
+		pools[i].waiting.assign(units, deque<pair<int, int> >());
+		pools[i].busyTime = 0;
+	}
+	disk.reset(configData, configData.getDeviceQuant(DEVICE_HARD_DRIVE));
+	dispatcher.reset(configData);
+	cache.reset(configData);
+	interrupts.reset(configData);
+	completions.clear();
+	
+	events = priority_queue<Event, vector<Event>, greater<Event> >();
+	readyQueue.clear();
+	now = 0;
+	sequence = 0;
+	token = 0;
+	quantum = max(configData.getProcessorQuantumNumber(), 1);
+	cpuBusyTime = 0;
+	operationStart = 0;
+	interruptReturn = -1;
+	running = -1;
+	lastRunning = -1;
+	contextSwitches = 0;
+	preemptions = 0;
+	preemptPending = false;
+
+}
+
+/**
+*	Function: saveEvent
+*	Description: Writes every field of event to checkpoint
+*/
+void EventEngine::saveEvent(CheckpointWriter& checkpoint, const Event& event)
+{
+
+	checkpoint.putInt(event.time);
+	checkpoint.putInt(event.sequence);
+	checkpoint.putInt(event.type);
+	checkpoint.putInt(event.pid);
+	checkpoint.putInt(event.device);
+	checkpoint.putInt(event.unit);
+	checkpoint.putInt(event.operation);
+	checkpoint.putInt(event.token);
+
+}
+
+/**
+*	Function: restoreEvent
+*	Description: Reads an event written by saveEvent() from checkpoint into event
+*/
+void EventEngine::restoreEvent(CheckpointReader& checkpoint, Event& event)
+{
+
+	event.time = checkpoint.getInt(0, LONG_MAX);
+	event.sequence = checkpoint.getInt(0, LONG_MAX);
+	event.type = checkpoint.getInt(ENGINE_ARRIVAL, ENGINE_INTERRUPT_RETURN);
+	event.pid = checkpoint.getInt(-1, (long) processes.size() - 1);
+	event.device = checkpoint.getInt(DEVICE_NONE, DEVICE_COUNT - 1);
+	event.unit = checkpoint.getInt(-1, event.device >= 0 ?
+								   (long) pools[event.device].busy.size() - 1 : -1);
+	event.operation = checkpoint.getInt(-1, event.pid >= 0 ?
+										(long) processes[event.pid].operations.size()
+										- 1 : -1);
+	event.token = checkpoint.getInt(0, LONG_MAX);
+
+}
+
+/**
+*	Function: operator>
+*	Description: returns true if this event happens after other
+*/
+bool EventEngine::Event::operator>(const Event& other) const
+{
+
+	if (time != other.time)
+	{
+		return time > other.time;
+	}
+	return sequence > other.sequence;
+
+}
+
+/**
+*	Function: operator<
+*	Description: returns true if this evaluated event happens before other
+*/
+bool EventEngine::EvaluatedEvent::operator<(const EvaluatedEvent& other) const
+{
+
+	if (time != other.time)
+	{
+		return time < other.time;
+	}
+	return sequence < other.sequence;
+
+}
+
+/**
+*	Function: evaluateDispatch
+*	Description: Gives the processor to the ready process chosen by selectNext() and
+*		works out its operations, or leaves it idle if no process is ready, as
+*		dispatch() does. Returns false if the run has to be simulated.
+*/
+bool EventEngine::evaluateDispatch()
+{
+
+	if (readyQueue.empty())
+	{
+		running = -1;
+		return 1;
+	}
+	
+	int position = selectNext();
+	running = readyQueue[position];
+	readyQueue.erase(readyQueue.begin() + position);
+	if (lastRunning >= 0 && lastRunning != running)
+	{
+		contextSwitches++;
+	}
+	lastRunning = running;
+	
+	//without preemption every dispatch is the start of a process
+	note(EVENT_PROCESS_START, running);
+	return evaluateProcess();
+
+}
+
+/**
+*	Function: evaluateProcess
+*	Description: Works out the running process from its next operation, as
+*		continueProcess() does: a processor or memory operation holds the processor
+*		until evaluate() ends it, I/O operations are issued and the process carries
+*		on. Returns false if the run has to be simulated.
+*/
+bool EventEngine::evaluateProcess()
+{
+
+	EngineProcess& process = processes[running];
+	int& next = evaluatedNext[running];
+	while (next < process.operations.size())
+	{
+		Operation& operation = process.operations[next];
+		note(operation.startEvent, running, operation.device);
+		if (operation.device == DEVICE_PROCESSOR || operation.device == DEVICE_MEMORY)
+		{
+			operationStart = now;
+			evaluatedOperation.time = now + operation.time;
+			evaluatedOperation.sequence = sequence++;
+			return 1;
+		}
+		if (!evaluateDevice(running, next))
+		{
+			return 0;
+		}
+		next++;
+	}
+	
+	note(EVENT_PROCESS_END, running);
+	return evaluateDispatch();
+
+}
+
+/**
+*	Function: evaluateDevice
+*	Description: Issues the operation at operation of the process at index to the
+*		unit the dispatcher picks, first freeing the units whose operations ended
+*		before it, and works out its end. Returns false if the unit is still busy,
+*		since the request would wait and the run has to be simulated.
+*/
+bool EventEngine::evaluateDevice(int index, int operation)
+{
+
+	Operation& request = processes[index].operations[operation];
+	DevicePool& pool = pools[request.device];
+	priority_queue<Event, vector<Event>, greater<Event> >& running =
+		evaluatedDevices[request.device];
+	while (!running.empty() && (running.top().time < now ||
+		   (running.top().time == now && running.top().sequence < evaluatedSequence)))
+	{
+		pool.busy[running.top().unit] = false;
+		dispatcher.release(request.device, running.top().unit);
+		running.pop();
+	}
+	
+	int unit = dispatcher.assign(processes[index].pid, request.device,
+								 processes[index].devicesUsed[request.device]++);
+	if (pool.busy[unit])
+	{
+		return 0;
+	}
+	
+	Event end;
+	end.time = now + request.time;
+	end.sequence = sequence++;
+	end.unit = unit;
+	running.push(end);
+	pool.busy[unit] = true;
+	pool.busyTime += request.time;
+	
+	EvaluatedEvent event = {end.time, end.sequence, request.endEvent, index,
+							request.device, unit};
+	evaluation.push_back(event);
+	return 1;
+
+}
+
+/**
+*	Function: note
+*	Description: Keeps an event of type for the process at index at the virtual time
+*		and sequence of the event being evaluated
+*/
+void EventEngine::note(int type, int index, int device, int unit)
+{
+
+	EvaluatedEvent event = {now, evaluatedSequence, type, index, device, unit};
+	evaluation.push_back(event);
+
+}
+
+/**
+*	Function: schedule
+*	Description: Adds an event of type for the process at index at virtual time
+*		eventTime. Operation and quantum events belong to the current dispatch.
+*/
+void EventEngine::schedule(long eventTime, int type, int index, int device, int unit,
+						   int operation)
+{
+
+	Event event;
+	event.time = eventTime;
+	event.sequence = sequence++;
+	event.type = type;
+	event.pid = index;
+	event.device = device;
+	event.unit = unit;
+	event.operation = operation;
+	event.token = token;
+	events.push(event);
+
+}
+
+/**
+*	Function: arrive
+*	Description: Makes the process at index ready. Dispatches it if the processor is
+*		idle; under STR the running process is preempted if the new process has less
+*		time remaining.
+*/
+void EventEngine::arrive(int index)
+{
+
+	log(EVENT_PROCESS_ARRIVE, index);
+	readyQueue.push_back(index);
+	
+	if (running < 0)
+	{
+		dispatch();
+	}
+	else if (configData.getCpuScheduleCode() == 3 &&
+			 processes[index].estimatedRemaining < getEstimate(running))
+	{
+		requestPreempt();
+	}
+
+}
+
+/**
+*	Function: dispatch
+*	Description: Gives the processor to the ready process chosen by selectNext(), or
+*		leaves it idle if no process is ready
+*/
+void EventEngine::dispatch()
+{
+
+	if (readyQueue.empty())
+	{
+		running = -1;
+		return;
+	}
+	
+	int position = selectNext();
+	running = readyQueue[position];
+	readyQueue.erase(readyQueue.begin() + position);
+	token++;
+	preemptPending = false;
+	
+	if (lastRunning >= 0 && lastRunning != running)
+	{
+		contextSwitches++;
+	}
+	lastRunning = running;
+	
+	EngineProcess& process = processes[running];
+	if (!process.started)
+	{
+		process.started = true;
+		log(EVENT_PROCESS_START, running);
+	}
+	if (configData.getCpuScheduleCode() == 4)
+	{
+		schedule(now + quantum, ENGINE_QUANTUM, running);
+	}
+	continueProcess();
+
+}
+
+/**
+*	Function: selectNext
+*	Description: returns the position in the ready queue of the process the scheduling
+*		code runs next. FIFO and RR take the front of the queue, PS the process with
+*		the most I/O operations, SJF the process with the fewest operations and STR
+*		the process with the least time remaining. Ties go to the front.
+*/
+int EventEngine::selectNext()
+{
+
+	int best = 0;
+	for (int i = 1; i < readyQueue.size(); i++)
+	{
+		EngineProcess& candidate = processes[readyQueue[i]];
+		EngineProcess& current = processes[readyQueue[best]];
+		switch (configData.getCpuScheduleCode())
+		{
+			case 1:
+				if (candidate.ioCount > current.ioCount)
+				{
+					best = i;
+				}
+			break;
+			case 2:
+				if (candidate.operations.size() < current.operations.size())
+				{
+					best = i;
+				}
+			break;
+			case 3:
+				if (candidate.estimatedRemaining < current.estimatedRemaining)
+				{
+					best = i;
+				}
+			break;
+		}
+	}
+	return best;
+
+}
+
+/**
+*	Function: continueProcess
+*	Description: Runs the running process from its next operation. I/O operations are
+*		handed to their device and the process carries on without waiting for them,
+*		as inputHandler() and outputHandler() do. A processor or memory operation keeps
+*		the processor until it ends. Once every operation has been issued the process
+*		ends and the next ready process is dispatched.
+*/
+void EventEngine::continueProcess()
+{
+
+	EngineProcess& process = processes[running];
+	while (process.next < process.operations.size())
+	{
+		Operation& operation = process.operations[process.next];
+		if (operation.device == DEVICE_PROCESSOR || operation.device == DEVICE_MEMORY)
+		{
+			if (process.remaining > 0)
+			{
+				log(EVENT_PROCESSING_RESUME, running);
+			}
+			else
+			{
+				process.remaining = operation.time;
+				log(operation.startEvent, running, operation.device);
+			}
+			operationStart = now;
+			schedule(now + process.remaining, ENGINE_OPERATION_DONE, running);
+			return;
+		}
+	
+		log(operation.startEvent, running, operation.device);
+		process.estimatedRemaining -= operation.time;
+		requestDevice(running, process.next);
+		process.next++;
+	}
+	
+	log(EVENT_PROCESS_END, running);
+	dispatch();
+
+}
+
+/**
+*	Function: finishOperation
+*	Description: Ends the processor or memory operation of the running process, then
+*		preempts it if that was asked for during the operation or carries on with its
+*		next operation
+*/
+void EventEngine::finishOperation()
+{
+
+	EngineProcess& process = processes[running];
+	Operation& operation = process.operations[process.next];
+	cpuBusyTime += now - operationStart;
+	process.estimatedRemaining -= process.remaining;
+	process.remaining = 0;
+	process.next++;
+	log(operation.endEvent, running, operation.device);
+	
+	if (preemptPending && process.next < process.operations.size())
+	{
+		preempt();
+	}
+	else
+	{
+		continueProcess();
+	}
+
+}
+
+/**
+*	Function: requestPreempt
+*	Description: Preempts the running process now if it is in a processor operation,
+*		otherwise once its memory operation or the interrupt handler holding the
+*		processor ends, since only processing can be interrupted in the simulator
+*/
+void EventEngine::requestPreempt()
+{
+
+	EngineProcess& process = processes[running];
+	Operation& operation = process.operations[process.next];
+	if (interruptReturn >= 0)
+	{
+		//already off the processor, preempted once the handler returns
+		preemptPending = true;
+	}
+	else if (operation.device == DEVICE_PROCESSOR &&
+			 now - operationStart < process.remaining)
+	{
+		cpuBusyTime += now - operationStart;
+		process.remaining -= now - operationStart;
+		process.estimatedRemaining -= now - operationStart;
+		log(EVENT_PROCESSING_INTERRUPT, running);
+		preempt();
+	}
+	else
+	{
+		preemptPending = true;
+	}
+
+}
+
+/**
+*	Function: preempt
+*	Description: Puts the running process at the back of the ready queue and
+*		dispatches the next process
+*/
+void EventEngine::preempt()
+{
+
+	preemptions++;
+	readyQueue.push_back(running);
+	running = -1;
+	dispatch();
+
+}
+
+/**
+*	Function: requestDevice
+*	Description: Hands the operation at operation of the process at index to the unit
+*		of its device the dispatcher picks, as inputHandler() and outputHandler() do.
+*		The operation starts if the unit is idle, otherwise it waits in the queue of
+*		the unit; hard drive requests wait in the queue of their drive unless the
+*		buffer cache serves them.
+*/
+void EventEngine::requestDevice(int index, int operation)
+{
+
+	Operation& request = processes[index].operations[operation];
+	DevicePool& pool = pools[request.device];
+	int block = request.block;
+	long time = request.time;
+	if (request.device == DEVICE_HARD_DRIVE && cache.isEnabled() && block >= 0)
+	{
+		//as Simulator::cacheRequest(), a request the cache serves skips the drive
+		CacheAccess access;
+		if (request.endEvent == EVENT_INPUT_END)
+		{
+			cache.read(block, request.cycles, access);
+		}
+		else
+		{
+			cache.write(block, request.cycles, access);
+		}
+		if (access.diskBlocks == 0)
+		{
+			schedule(now + access.memoryTime, ENGINE_CACHE_DONE, index,
+					 DEVICE_HARD_DRIVE, -1, operation);
+			return;
+		}
+		block = access.diskBlock;
+		time = access.diskBlocks * (long) configData.getHardDriveTime() +
+			   access.memoryTime;
+	}
+	
+	int unit = dispatcher.assign(processes[index].pid, request.device,
+								 processes[index].devicesUsed[request.device]++);
+	if (request.device == DEVICE_HARD_DRIVE)
+	{
+		disk.submit(unit, index, operation, block, time, now);
+		startDisk(unit);
+	}
+	else if (pool.busy[unit])
+	{
+		pool.waiting[unit].push_back(make_pair(index, operation));
+	}
+	else
+	{
+		pool.busy[unit] = true;
+		pool.busyTime += request.time;
+		schedule(now + request.time, ENGINE_DEVICE_DONE, index, request.device, unit,
+				 operation);
+	}
+
+}
+
+/**
+*	Function: finishDevice
+*	Description: Ends the I/O operation of event, raising its completion interrupt,
+*		and starts the next request waiting for the unit that became free
+*/
+void EventEngine::finishDevice(const Event& event)
+{
+
+	DevicePool& pool = pools[event.device];
+	deque<pair<int, int> >& waiting = pool.waiting[event.unit];
+	pool.busy[event.unit] = false;
+	dispatcher.release(event.device, event.unit);
+	completeDevice(event.pid, event.operation, event.device, event.unit);
+	
+	if (event.device == DEVICE_HARD_DRIVE)
+	{
+		//requests merged into the operation end with it
+		vector<DiskRequest> merged;
+		disk.finish(event.unit, merged);
+		for (int i = 0; i < merged.size(); i++)
+		{
+			dispatcher.release(DEVICE_HARD_DRIVE, event.unit);
+			completeDevice(merged[i].process, merged[i].operation, DEVICE_HARD_DRIVE,
+						   event.unit);
+		}
+		startDisk(event.unit);
+	}
+	else if (!waiting.empty())
+	{
+		pair<int, int> request = waiting.front();
+		long time = processes[request.first].operations[request.second].time;
+		waiting.pop_front();
+		pool.busy[event.unit] = true;
+		pool.busyTime += time;
+		schedule(now + time, ENGINE_DEVICE_DONE, request.first, event.device,
+				 event.unit, request.second);
+	}
+
+}
+
+/**
+*	Function: startDisk
+*	Description: Starts the request the algorithm of drive picks if the drive is idle
+*		and the batching window of its oldest request has passed, otherwise retries
+*		when it has. The drive is busy for the seek, rotation and transfer of the
+*		request and of the requests merged into it.
+*/
+void EventEngine::startDisk(int drive)
+{
+
+	//an idle drive waits out the batching window of its oldest request
+	double ready = disk.readyTime(drive);
+	if (ready > now)
+	{
+		schedule((long) ceil(ready), ENGINE_DISK_READY, -1, DEVICE_HARD_DRIVE, drive);
+		return;
+	}
+	
+	DiskRequest request;
+	long serviceTime;
+	if (disk.start(drive, now, request, serviceTime))
+	{
+		pools[DEVICE_HARD_DRIVE].busy[drive] = true;
+		pools[DEVICE_HARD_DRIVE].busyTime += serviceTime;
+		schedule(now + serviceTime, ENGINE_DEVICE_DONE, request.process,
+				 DEVICE_HARD_DRIVE, drive, request.operation);
+	}
+
+}
+
+/**
+*	Function: completeDevice
+*	Description: Raises the completion interrupt of the operation at operation of the
+*		process at index on unit of device. The operation ends once the interrupt is
+*		delivered, at once or when enough completions have gathered or the oldest
+*		has waited long enough.
+*/
+void EventEngine::completeDevice(int index, int operation, int device, int unit)
+{
+
+	Event completion;
+	completion.pid = index;
+	completion.operation = operation;
+	completion.device = device;
+	completion.unit = unit;
+	completions.push_back(completion);
+	if (interrupts.raise(now))
+	{
+		deliverInterrupt();
+	}
+	else if (completions.size() == 1 && interrupts.deadline() >= 0)
+	{
+		schedule((long) ceil(interrupts.deadline()), ENGINE_INTERRUPT_TIMER, index);
+	}
+
+}
+
+/**
+*	Function: deliverInterrupt
+*	Description: Delivers the waiting completions with one interrupt, ending their
+*		operations. The handler takes the processor from a process in a processor
+*		operation the way a preemption does, and the process resumes once the
+*		handler returns; an idle processor or a memory operation absorbs it.
+*/
+void EventEngine::deliverInterrupt()
+{
+
+	interrupts.deliver(now);
+	for (int i = 0; i < completions.size(); i++)
+	{
+		Event& completion = completions[i];
+		log(processes[completion.pid].operations[completion.operation].endEvent,
+			completion.pid, completion.device, completion.unit);
+	}
+	completions.clear();
+	
+	long handlerTime = interrupts.getHandlerTime();
+	if (handlerTime <= 0 || running < 0)
+	{
+		return;
+	}
+	
+	EngineProcess& process = processes[running];
+	Operation& operation = process.operations[process.next];
+	if (interruptReturn >= 0)
+	{
+		//a handler is already running, this one runs right after it
+		interruptReturn += handlerTime;
+	}
+	else if (operation.device == DEVICE_PROCESSOR &&
+			 now - operationStart < process.remaining)
+	{
+		cpuBusyTime += now - operationStart;
+		process.remaining -= now - operationStart;
+		process.estimatedRemaining -= now - operationStart;
+		log(EVENT_PROCESSING_INTERRUPT, running);
+		interruptReturn = now + handlerTime;
+	}
+	else
+	{
+		return;
+	}
+	
+	//stales the end of the operation and the quantum of the process
+	token++;
+	schedule(interruptReturn, ENGINE_INTERRUPT_RETURN, running);
+
+}
+
+/**
+*	Function: returnFromInterrupt
+*	Description: Gives the processor back to the process the handlers interrupted, or
+*		preempts it if that was asked for while they ran
+*/
+void EventEngine::returnFromInterrupt()
+{
+
+	interruptReturn = -1;
+	if (preemptPending)
+	{
+		preempt();
+		return;
+	}
+	
+	log(EVENT_PROCESSING_RESUME, running);
+	operationStart = now;
+	schedule(now + processes[running].remaining, ENGINE_OPERATION_DONE, running);
+	if (configData.getCpuScheduleCode() == 4)
+	{
+		schedule(now + quantum, ENGINE_QUANTUM, running);
+	}
+
+}
+
+/**
+*	Function: getEstimate
+*	Description: returns the milliseconds of work the process at index has left,
+*		counting the part of its current operation that already ran
+*/
+long EventEngine::getEstimate(int index)
+{
+
+	long estimate = processes[index].estimatedRemaining;
+	if (index == running && interruptReturn < 0)
+	{
+		estimate -= now - operationStart;
+	}
+	return estimate;
+
+}
+
+/**
+*	Function: log
+*	Description: Hands an event of type for the process at index, stamped with the
+*		virtual time in seconds, to every sink
+*/
+void EventEngine::log(int type, int index, int device, int unit)
+{
+
+	LogEvent event;
+	event.timestamp = now / 1000.0;
+	event.type = type;
+	event.pid = processes[index].pid;
+	event.device = device;
+	event.unit = unit;
+	event.address = 0;
+	for (int i = 0; i < sinks.size(); i++)
+	{
+		sinks[i]->addEvent(event);
+	}
+
+}
@@ -0,0 +1,181 @@
+/**
+*	File Name: EventEngine.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class EventEngine. A discrete-event model of
+*		the simulator that runs a program under a scheduling policy on a virtual
+*		clock, so runs are deterministic and take no real time. Runs without
+*		preemption or contention are worked out in closed form.
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef EVENT_ENGINE_
+#define EVENT_ENGINE_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <queue>
+#include <string>
+#include "Config.h"
+#include "MetaData.h"
+#include "Logger.h"
+#include "DiskModel.h"
+#include "DeviceDispatcher.h"
+#include "BufferCache.h"
+#include "InterruptController.h"
+#include "Checkpoint.h"
+
+using namespace std;
+
+//outcome of running one program under one scheduling policy
+struct EngineResult
+{
+	int processCount, contextSwitches, preemptions;
+	long makespan; //milliseconds of virtual time until the last operation ended
+	double throughput; //processes finished per second of virtual time
+	double cpuUtilization;
+	double deviceUtilization[DEVICE_COUNT]; //busy time over every unit of the device
+};
+
+class EventEngine
+{
+
+	//EventEngine class public declarations
+	public:
+	
+		EventEngine(Config);
+	
+		void addSink(EventSink*);
+		int load(deque<MetaData>);
+		bool run(EngineResult&);
+		void setFastPath(bool);
+		bool evaluate(EngineResult&);
+		void flushEvaluation();
+	
+		bool start();
+		bool runUntil(long);
+		void finish(EngineResult&);
+		bool saveCheckpoint(ostream&);
+		bool restoreCheckpoint(istream&);
+	
+		//milliseconds between process arrivals, as in Simulator::loader()
+		static const long ARRIVAL_INTERVAL = 100;
+	
+	//EventEngine class private declarations
+	private:
+	
+		//one meta-data instruction of a process
+		struct Operation
+		{
+			int device; //DeviceId
+			int startEvent, endEvent; //EventType logged when it starts and ends
+			long time; //milliseconds
+			int block; //hard drive block, -1 if none
+			int cycles; //blocks moved by a hard drive operation
+		};
+	
+		struct EngineProcess
+		{
+			int pid;
+			vector<Operation> operations;
+			int next; //operation running on the processor or to be issued next
+			long remaining; //milliseconds left of the operation on the processor
+			long estimatedRemaining; //milliseconds of operations not yet finished
+			int ioCount;
+			int devicesUsed[DEVICE_COUNT]; //requests made so far, as counted by the PCB
+			bool started;
+		};
+	
+		//something that happens at a point of virtual time
+		struct Event
+		{
+			long time, sequence; //events at the same time happen in order of sequence
+			int type, pid, device, unit, operation;
+			long token; //dispatch the event belongs to, stale once it changes
+	
+			bool operator>(const Event&) const;
+		};
+	
+		enum EngineEventType
+		{
+			ENGINE_ARRIVAL, ENGINE_OPERATION_DONE, ENGINE_QUANTUM, ENGINE_DEVICE_DONE,
+			ENGINE_CACHE_DONE, ENGINE_DISK_READY, ENGINE_INTERRUPT_TIMER,
+			ENGINE_INTERRUPT_RETURN
+		};
+	
+		//an event worked out by evaluate(), logged in order of time and sequence
+		struct EvaluatedEvent
+		{
+			long time, sequence;
+			int type, index, device, unit;
+	
+			bool operator<(const EvaluatedEvent&) const;
+		};
+	
+		//units of one device and the requests waiting for them
+		struct DevicePool
+		{
+			vector<bool> busy;
+			vector<deque<pair<int, int> > > waiting; //pid and operation, per unit
+			long busyTime;
+		};
+	
+		void reset();
+		void getResult(EngineResult&);
+		bool evaluateDispatch();
+		bool evaluateProcess();
+		bool evaluateDevice(int, int);
+		void note(int, int, int = DEVICE_NONE, int = -1);
+		void saveEvent(CheckpointWriter&, const Event&);
+		void restoreEvent(CheckpointReader&, Event&);
+		void schedule(long, int, int, int = DEVICE_NONE, int = -1, int = -1);
+		void arrive(int);
+		void dispatch();
+		int selectNext();
+		void continueProcess();
+		void finishOperation();
+		void preempt();
+		void requestPreempt();
+		void requestDevice(int, int);
+		void finishDevice(const Event&);
+		void startDisk(int);
+		void completeDevice(int, int, int, int);
+		void deliverInterrupt();
+		void returnFromInterrupt();
+		long getEstimate(int);
+		void log(int, int, int = DEVICE_NONE, int = -1);
+	
+		Config configData;
+		vector<EventSink*> sinks;
+		vector<EngineProcess> processes; //pid - 1 is the index
+		vector<int> arrivalOrder; //indeces of the processes in the order they arrive
+		priority_queue<Event, vector<Event>, greater<Event> > events;
+		deque<int> readyQueue;
+		DevicePool pools[DEVICE_COUNT];
+		DiskModel disk; //queues of the hard drives, served by their own algorithm
+		DeviceDispatcher dispatcher; //picks the unit of each request
+		BufferCache cache; //serves hard drive blocks from memory if enabled
+		InterruptController interrupts;
+		vector<Event> completions; //device completions waiting for their interrupt
+	
+		//state of evaluate()
+		bool fastPath; //run() tries evaluate() before simulating
+		vector<EvaluatedEvent> evaluation;
+		vector<int> evaluatedNext; //operation each process issues next
+		priority_queue<Event, vector<Event>, greater<Event> >
+			evaluatedDevices[DEVICE_COUNT]; //requests running on each device
+		Event evaluatedOperation; //end of the operation on the processor
+		long evaluatedSequence; //sequence of the event being evaluated
+	
+		long now, sequence, token, quantum, cpuBusyTime, operationStart;
+		long interruptReturn; //when the running handler ends, -1 if none is running
+		int running, lastRunning, contextSwitches, preemptions;
+		bool preemptPending;
+	
+};
+
+#endif
@@ -0,0 +1,352 @@
+/**
+*	File Name: InterruptController.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class InterruptController. Queues
+*		the completion interrupts of the devices and delivers them to the processor,
+*		coalescing several completions into one interrupt, and charges the processor
+*		for running the interrupt handler
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "InterruptController.h"
+#include <stdio.h>
+#include <limits.h>
+
+/**
+*	Function: InterruptController
+*	Description: Default constructor for InterruptController class, every completion
+*		is delivered at once and the handler takes no time
+*/
+InterruptController::InterruptController()
+{
+
+	pthread_mutex_init(&mutexInterrupt, NULL);
+	pthread_cond_init(&interruptDelivered, NULL);
+	reset(Config());
+
+}
+
+/**
+*	Function: ~InterruptController
+*	Description: Destructor for InterruptController class
+*/
+InterruptController::~InterruptController()
+{
+
+	pthread_cond_destroy(&interruptDelivered);
+	pthread_mutex_destroy(&mutexInterrupt);
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every completion and measurement. The coalescing thresholds
+*		and the time of the handler are taken from configData.
+*/
+void InterruptController::reset(Config configData)
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	coalesceCount = configData.getInterruptCoalesceCount();
+	coalesceTime = configData.getInterruptCoalesceTime();
+	handlerTime = configData.getInterruptHandlerTime();
+	pending.clear();
+	completions = 0;
+	interrupts = 0;
+	totalDelay = 0;
+	maxDelay = 0;
+	owedTime = 0;
+	draining = false;
+	unacknowledged = 0;
+	timeScale = configData.getTimeScale();
+	clock_gettime(CLOCK_MONOTONIC, &origin);
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: getHandlerTime
+*	Description: returns the milliseconds of processor time each interrupt takes
+*/
+long InterruptController::getHandlerTime()
+{
+
+	return handlerTime;
+
+}
+
+/**
+*	Function: raise
+*	Description: Queues the completion of a device at time now (msec). Returns true if
+*		coalesceCount completions are now waiting, or the controller is draining, so
+*		the interrupt has to be delivered. Used by callers that keep their own clock
+*		and call deliver() themselves.
+*/
+bool InterruptController::raise(double now)
+{
+
+	pending.push_back(now);
+	completions++;
+	
+	return draining || pending.size() >= coalesceCount;
+
+}
+
+/**
+*	Function: deadline
+*	Description: returns the time (msec) the waiting completions have to be delivered
+*		by, or -1 if none is waiting or they may wait until enough have gathered
+*/
+double InterruptController::deadline()
+{
+
+	if (pending.empty() || coalesceTime <= 0)
+	{
+		return -1;
+	}
+	
+	return pending.front() + coalesceTime;
+
+}
+
+/**
+*	Function: deliver
+*	Description: Delivers every waiting completion with one interrupt at time now
+*		(msec), charging the processor for the handler, and returns how many were
+*		delivered
+*/
+int InterruptController::deliver(double now)
+{
+
+	int delivered = pending.size();
+	if (delivered == 0)
+	{
+		return 0;
+	}
+	
+	for (int i = 0; i < pending.size(); i++)
+	{
+		double delay = now - pending[i];
+		totalDelay += delay;
+		if (delay > maxDelay)
+		{
+			maxDelay = delay;
+		}
+	}
+	pending.clear();
+	interrupts++;
+	owedTime += handlerTime;
+	pthread_cond_broadcast(&interruptDelivered);
+	
+	return delivered;
+
+}
+
+/**
+*	Function: expect
+*	Description: Announces a device request whose completion will be raised by 
+*		complete() and acknowledged, so drain() waits for it
+*/
+void InterruptController::expect()
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	unacknowledged++;
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: complete
+*	Description: Thread safe form of raise() for the simulator, timed by the clock of
+*		the controller. Queues the completion of a device and blocks until it is
+*		delivered, either because enough completions gathered or because the oldest
+*		of them waited coalesceTime. The caller acknowledges the interrupt once it
+*		has handled the completion.
+*/
+void InterruptController::complete()
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	long batch = interrupts;
+	if (raise(elapsed()))
+	{
+		deliver(elapsed());
+	}
+	while (interrupts == batch)
+	{
+		double limit = deadline();
+		if (limit < 0)
+		{
+			pthread_cond_wait(&interruptDelivered, &mutexInterrupt);
+			continue;
+		}
+	
+		struct timespec until;
+		long wait = limit > elapsed() ?
+					(long) ((limit - elapsed()) * timeScale * 1000000) : 0;
+		clock_gettime(CLOCK_REALTIME, &until);
+		until.tv_sec += (until.tv_nsec + wait) / 1000000000;
+		until.tv_nsec = (until.tv_nsec + wait) % 1000000000;
+		pthread_cond_timedwait(&interruptDelivered, &mutexInterrupt, &until);
+		if (interrupts == batch && elapsed() >= deadline())
+		{
+			deliver(elapsed());
+		}
+	}
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: acknowledge
+*	Description: Signals the end of the interrupt a completion raised by complete()
+*		was delivered with, the request announced by expect() is done
+*/
+void InterruptController::acknowledge()
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	unacknowledged--;
+	pthread_cond_broadcast(&interruptDelivered);
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: drain
+*	Description: Delivers the completions still waiting and every later completion
+*		as soon as it is raised, then blocks until every request announced by
+*		expect() has been acknowledged, so no device thread is left running or
+*		blocked in complete() while the program ends
+*/
+void InterruptController::drain()
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	draining = true;
+	deliver(elapsed());
+	while (unacknowledged > 0)
+	{
+		pthread_cond_wait(&interruptDelivered, &mutexInterrupt);
+	}
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: takeOwedTime
+*	Description: Returns the milliseconds the interrupt handlers held the processor
+*		since the last call, which the running process has to make up
+*/
+long InterruptController::takeOwedTime()
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	long owed = owedTime;
+	owedTime = 0;
+	pthread_mutex_unlock(&mutexInterrupt);
+	
+	return owed;
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the completions, the interrupts that delivered them, how long
+*		completions waited for delivery and the processor time of the handlers to
+*		out. Writes nothing if the controller is left at its defaults or no device
+*		completed a request.
+*/
+void InterruptController::print(ostream& out)
+{
+
+	char line[160];
+	
+	pthread_mutex_lock(&mutexInterrupt);
+	if (completions == 0 || (coalesceCount <= 1 && coalesceTime <= 0 &&
+		handlerTime <= 0))
+	{
+		pthread_mutex_unlock(&mutexInterrupt);
+		return;
+	}
+	
+	out << endl << "Interrupts (coalescing " << coalesceCount << " completions or "
+		<< coalesceTime << " msec, handler " << handlerTime << " msec)" << endl;
+	snprintf(line, sizeof(line), "%11s %10s %9s %10s %9s %12s\n", "completions",
+			 "interrupts", "per intr", "mean delay", "max delay", "handler msec");
+	out << line;
+	snprintf(line, sizeof(line), "%11ld %10ld %9.2f %10.2f %9.2f %12ld\n", completions,
+			 interrupts, interrupts > 0 ? (double) completions / interrupts : 0.0,
+			 completions > 0 ? totalDelay / completions : 0.0, maxDelay,
+			 interrupts * handlerTime);
+	out << line;
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the arrival of every completion not yet delivered, the handler
+*		time owed and the measurements to checkpoint
+*/
+void InterruptController::save(CheckpointWriter& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	checkpoint.putInt(pending.size());
+	for (int i = 0; i < pending.size(); i++)
+	{
+		checkpoint.putDouble(pending[i]);
+	}
+	checkpoint.putInt(completions);
+	checkpoint.putInt(interrupts);
+	checkpoint.putDouble(totalDelay);
+	checkpoint.putDouble(maxDelay);
+	checkpoint.putInt(owedTime);
+	pthread_mutex_unlock(&mutexInterrupt);
+
+}
+
+/**
+*	Function: restore
+*	Description: Reads the state written by save() from checkpoint into a controller
+*		that was reset, keeping the thresholds and handler time it was reset with.
+*		Returns false if the checkpoint is not good.
+*/
+bool InterruptController::restore(CheckpointReader& checkpoint)
+{
+
+	pthread_mutex_lock(&mutexInterrupt);
+	pending.resize(checkpoint.getCount());
+	for (int i = 0; checkpoint.isGood() && i < pending.size(); i++)
+	{
+		pending[i] = checkpoint.getDouble();
+	}
+	completions = checkpoint.getInt(0, LONG_MAX);
+	interrupts = checkpoint.getInt(0, LONG_MAX);
+	totalDelay = checkpoint.getDouble();
+	maxDelay = checkpoint.getDouble();
+	owedTime = checkpoint.getInt(0, LONG_MAX);
+	pthread_mutex_unlock(&mutexInterrupt);
+	
+	return checkpoint.isGood();
+
+}
+
+/**
+*	Function: elapsed
+*	Description: returns the simulated milliseconds since the controller was last
+*		reset
+*/
+double InterruptController::elapsed()
+{
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - origin.tv_sec) * 1000.0 +
+			(now.tv_nsec - origin.tv_nsec) / 1000000.0) / timeScale;
+
+}
@@ -0,0 +1,76 @@
+/**
+*	File Name: InterruptController.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class InterruptController. Queues the
+*		completion interrupts of the devices and delivers them to the processor,
+*		coalescing several completions into one interrupt, and charges the processor
+*		for running the interrupt handler
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef INTERRUPT_CONTROLLER_
+#define INTERRUPT_CONTROLLER_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <deque>
+#include <pthread.h>
+#include <time.h>
+#include "Config.h"
+#include "Checkpoint.h"
+
+using namespace std;
+
+class InterruptController
+{
+
+	//InterruptController class public declarations
+	public:
+	
+		InterruptController();
+		~InterruptController();
+	
+		void reset(Config);
+		long getHandlerTime();
+	
+		bool raise(double);
+		double deadline();
+		int deliver(double);
+	
+		void expect();
+		void complete();
+		void acknowledge();
+		void drain();
+		long takeOwedTime();
+	
+		void print(ostream&);
+		void save(CheckpointWriter&);
+		bool restore(CheckpointReader&);
+	
+	//InterruptController class private declarations
+	private:
+	
+		double elapsed();
+	
+		int coalesceCount; //completions that raise an interrupt at once
+		double coalesceTime; //msec the oldest completion may wait, 0 for no limit
+		long handlerTime; //msec of processor time each interrupt takes
+	
+		deque<double> pending; //arrival of each completion not yet delivered
+		long completions, interrupts;
+		double totalDelay, maxDelay; //msec from completion to delivery
+		long owedTime; //msec of handler time not yet taken from a process
+		bool draining; //set by drain(), completions are no longer held back
+		int unacknowledged; //completions announced by expect() and not acknowledged
+	
+		struct timespec origin; //start of the clock used by complete()
+		double timeScale; //real time per unit of simulated time
+		pthread_mutex_t mutexInterrupt;
+		pthread_cond_t interruptDelivered;
+	
+};
+
+#endif
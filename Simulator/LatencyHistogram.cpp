@@ -0,0 +1,317 @@
+/**
+*	File Name: LatencyHistogram.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class LatencyHistogram. A fixed size
+*		log-linear (HDR style) histogram of microsecond values that any number of
+*		threads can record into without locking
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "LatencyHistogram.h"
+
+pthread_mutex_t LatencyHistogram::mutexLeases = PTHREAD_MUTEX_INITIALIZER;
+vector<int> LatencyHistogram::freeShards;
+int LatencyHistogram::nextShard = 0;
+
+/**
+*	Function: LatencyHistogram
+*	Description: Default constructor for LatencyHistogram class
+*/
+LatencyHistogram::LatencyHistogram()
+{
+
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		shards[i].store(NULL, memory_order_relaxed);
+	}
+
+}
+
+/**
+*	Function: ~LatencyHistogram
+*	Description: Destructor for LatencyHistogram class
+*/
+LatencyHistogram::~LatencyHistogram()
+{
+
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		delete shards[i].load(memory_order_relaxed);
+	}
+
+}
+
+/**
+*	Function: reset
+*	Description: Sets every count back to zero. Must not be called while other threads
+*		are recording.
+*/
+void LatencyHistogram::reset()
+{
+
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		Shard* shard = shards[i].load(memory_order_acquire);
+		if (shard != NULL)
+		{
+			clear(shard);
+		}
+	}
+
+}
+
+/**
+*	Function: record
+*	Description: Counts value (in microseconds) in the bucket of the calling thread's
+*		shard. Only relaxed atomic additions are used, so threads never wait on each
+*		other and threads of different shards never touch the same counters.
+*/
+void LatencyHistogram::record(unsigned long long value)
+{
+
+	Shard* shard = getShard(getShard());
+	shard->counts[getBucketIndex(value)].fetch_add(1, memory_order_relaxed);
+	shard->total.fetch_add(value, memory_order_relaxed);
+
+}
+
+/**
+*	Function: merge
+*	Description: returns the counts of every shard added together
+*/
+LatencyHistogram::Snapshot LatencyHistogram::merge()
+{
+
+	Snapshot snapshot;
+	snapshot.counts.assign(BUCKET_COUNT, 0);
+	snapshot.count = 0;
+	snapshot.total = 0;
+	
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		Shard* shard = shards[i].load(memory_order_acquire);
+		if (shard == NULL)
+		{
+			continue;
+		}
+		for (int j = 0; j < BUCKET_COUNT; j++)
+		{
+			unsigned long long count = shard->counts[j].load(memory_order_relaxed);
+			snapshot.counts[j] += count;
+			snapshot.count += count;
+		}
+		snapshot.total += shard->total.load(memory_order_relaxed);
+	}
+	
+	return snapshot;
+
+}
+
+/**
+*	Function: getBucketIndex
+*	Description: returns the bucket of value. Values below 2 * SUB_BUCKET_COUNT get a
+*		bucket each. Above that, every power of two range is split into
+*		SUB_BUCKET_COUNT equal buckets.
+*/
+int LatencyHistogram::getBucketIndex(unsigned long long value)
+{
+
+	if (value < 2 * SUB_BUCKET_COUNT)
+	{
+		return (int) value;
+	}
+	
+	int highestBit = 63 - __builtin_clzll(value);
+	if (highestBit >= MAX_BITS)
+	{
+		return BUCKET_COUNT - 1;
+	}
+	int shift = highestBit - SUB_BUCKET_BITS;
+	return (shift + 1) * SUB_BUCKET_COUNT + (int) (value >> shift) - SUB_BUCKET_COUNT;
+
+}
+
+/**
+*	Function: getBucketValue
+*	Description: returns the highest value that falls in the bucket index
+*/
+unsigned long long LatencyHistogram::getBucketValue(int index)
+{
+
+	if (index < 2 * SUB_BUCKET_COUNT)
+	{
+		return index;
+	}
+	
+	int shift = index / SUB_BUCKET_COUNT - 1;
+	unsigned long long subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+	return ((subBucket + 1) << shift) - 1;
+
+}
+
+/**
+*	Function: getShard
+*	Description: returns the shard index of the calling thread, the same one in every
+*		histogram. The thread leases it the first time it records and keeps it until
+*		it exits, so no two live threads share one unless more than SHARD_COUNT
+*		threads record at once.
+*/
+int LatencyHistogram::getShard()
+{
+
+	static thread_local ShardLease lease;
+	
+	return lease.shard;
+
+}
+
+/**
+*	Function: getShard
+*	Description: returns the counts of shard index in this histogram, made the first
+*		time a thread with that index records into it
+*/
+LatencyHistogram::Shard* LatencyHistogram::getShard(int index)
+{
+
+	Shard* shard = shards[index].load(memory_order_acquire);
+	if (shard != NULL)
+	{
+		return shard;
+	}
+	
+	//a thread that lost a race for an index it shares uses the winner's shard
+	Shard* made = new Shard;
+	clear(made);
+	if (shards[index].compare_exchange_strong(shard, made, memory_order_acq_rel))
+	{
+		return made;
+	}
+	delete made;
+	return shard;
+
+}
+
+/**
+*	Function: clear
+*	Description: Sets every count of shard to zero
+*/
+void LatencyHistogram::clear(Shard* shard)
+{
+
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		shard->counts[i].store(0, memory_order_relaxed);
+	}
+	shard->total.store(0, memory_order_relaxed);
+
+}
+
+/**
+*	Function: ShardLease
+*	Description: Takes a shard index handed back by a thread that exited, or the next
+*		unused one
+*/
+LatencyHistogram::ShardLease::ShardLease()
+{
+
+	pthread_mutex_lock(&mutexLeases);
+	if (!freeShards.empty())
+	{
+		shard = freeShards.back();
+		freeShards.pop_back();
+	}
+	else if (nextShard < SHARD_COUNT)
+	{
+		shard = nextShard++;
+	}
+	else
+	{
+		shard = SHARD_COUNT - 1;
+	}
+	pthread_mutex_unlock(&mutexLeases);
+
+}
+
+/**
+*	Function: ~ShardLease
+*	Description: Hands the shard index back once its thread exits. The counts stay in
+*		every histogram and the next thread to take the index adds to them. The last
+*		index may be shared, so it is never handed back.
+*/
+LatencyHistogram::ShardLease::~ShardLease()
+{
+
+	pthread_mutex_lock(&mutexLeases);
+	if (shard < SHARD_COUNT - 1)
+	{
+		freeShards.push_back(shard);
+	}
+	pthread_mutex_unlock(&mutexLeases);
+
+}
+
+/**
+*	Function: getValueAtPercentile
+*	Description: returns the value below which percentile percent of the recorded
+*		values fall (the highest value of the bucket it lands in), 0 if nothing was
+*		recorded
+*/
+unsigned long long LatencyHistogram::Snapshot::getValueAtPercentile(double percentile)
+{
+
+	if (count == 0)
+	{
+		return 0;
+	}
+	
+	unsigned long long rank = (unsigned long long) (percentile / 100 * count + 0.5);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+	
+	unsigned long long seen = 0;
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		seen += counts[i];
+		if (seen >= rank)
+		{
+			return getBucketValue(i);
+		}
+	}
+	return getBucketValue(BUCKET_COUNT - 1);
+
+}
+
+/**
+*	Function: getMax
+*	Description: returns the highest value of the highest bucket used, 0 if nothing was
+*		recorded
+*/
+unsigned long long LatencyHistogram::Snapshot::getMax()
+{
+
+	for (int i = BUCKET_COUNT - 1; i >= 0; i--)
+	{
+		if (counts[i] > 0)
+		{
+			return getBucketValue(i);
+		}
+	}
+	return 0;
+
+}
+
+/**
+*	Function: getMean
+*	Description: returns the exact mean of the recorded values, 0 if nothing was
+*		recorded
+*/
+double LatencyHistogram::Snapshot::getMean()
+{
+
+	return count > 0 ? total / (double) count : 0;
+
+}
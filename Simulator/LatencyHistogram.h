@@ -0,0 +1,95 @@
+/**
+*	File Name: LatencyHistogram.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class LatencyHistogram. A fixed size
+*		log-linear (HDR style) histogram of microsecond values that any number of
+*		threads can record into without locking
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef LATENCY_HISTOGRAM_
+#define LATENCY_HISTOGRAM_
+
+//library inclusion and directives
+
+#include <vector>
+#include <atomic>
+#include <pthread.h>
+
+using namespace std;
+
+class LatencyHistogram
+{
+
+	//LatencyHistogram class public declarations
+	public:
+
+		LatencyHistogram();
+		~LatencyHistogram();
+
+		void reset();
+		void record(unsigned long long);
+
+		//every value is kept to within 1/SUB_BUCKET_COUNT (about 3%) of itself,
+		//values of 2^MAX_BITS microseconds (about 19 hours) or more share the last
+		//bucket
+		static const int SUB_BUCKET_BITS = 5;
+		static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+		static const int MAX_BITS = 36;
+		static const int BUCKET_COUNT = (MAX_BITS - SUB_BUCKET_BITS + 1) *
+										SUB_BUCKET_COUNT;
+
+		//every thread recording at the same time gets its own copy of the counts, up
+		//to this many threads, after which the newest ones share the last copy
+		static const int SHARD_COUNT = 64;
+
+		//counts of every shard added together, taken once recording is done
+		struct Snapshot
+		{
+			vector<unsigned long long> counts;
+			unsigned long long count, total;
+
+			unsigned long long getValueAtPercentile(double);
+			unsigned long long getMax();
+			double getMean();
+		};
+
+		Snapshot merge();
+
+		static int getBucketIndex(unsigned long long);
+		static unsigned long long getBucketValue(int);
+
+	//LatencyHistogram class private declarations
+	private:
+
+		//counts of one recording thread, made the first time the thread records
+		struct Shard
+		{
+			atomic<unsigned long long> counts[BUCKET_COUNT];
+			atomic<unsigned long long> total;
+		};
+
+		//shard index held by a thread while it is alive, handed back when it exits
+		struct ShardLease
+		{
+			ShardLease();
+			~ShardLease();
+
+			int shard;
+		};
+
+		static int getShard();
+		Shard* getShard(int);
+		static void clear(Shard*);
+
+		static pthread_mutex_t mutexLeases;
+		static vector<int> freeShards; //shards handed back by threads that exited
+		static int nextShard;
+
+		atomic<Shard*> shards[SHARD_COUNT];
+
+};
+
+#endif
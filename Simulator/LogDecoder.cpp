@@ -0,0 +1,136 @@
+/**
+*	File Name: LogDecoder.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Offline decoder for binary traces written with "Log: Log to
+*		Binary". Prints every event of the trace in the same text format the
+*		simulator uses when logging to the monitor or a file, or exports the trace as
+*		Chrome Trace Event JSON for a timeline viewer (chrome://tracing or Perfetto)
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+//library inclusion and directives
+
+#include <iostream>
+#include <fstream>
+#include <string.h>
+#include "Logger.h"
+#include "ChromeTrace.h"
+
+using namespace std;
+
+//function headers
+
+bool decodeTrace(ifstream&, ostream&, bool);
+
+/**
+*	Function: main
+*	Description: Decodes the binary trace given as the first argument and writes the
+*		text to the file given as the second argument, or to the monitor if there is
+*		no second argument. With --chrome first, writes Chrome Trace Event JSON 
+*		instead of text.
+*/
+int main(int argc, char *argv[])
+{
+
+	bool chrome = false;
+	int first = 1;
+	if (argc > 1 && string(argv[1]) == "--chrome")
+	{
+		chrome = true;
+		first = 2;
+	}
+	
+	if (argc - first < 1 || argc - first > 2)
+	{
+		cout << "ERROR: usage: " << argv[0] << " [--chrome] traceFile [outputFile]" 
+			 << endl;
+		return -1;
+	}
+	
+	ifstream fin(argv[first], ios::in | ios::binary);
+	if (!fin.is_open())
+	{
+		cout << "ERROR: Trace " << argv[first] << " could not be opened" << endl;
+		return -1;
+	}
+	
+	bool okToContinue;
+	if (argc - first == 2)
+	{
+		ofstream fout(argv[first + 1]);
+		if (!fout.is_open())
+		{
+			cout << "ERROR: Output file " << argv[first + 1] << " could not be opened" 
+				 << endl;
+			return -1;
+		}
+		okToContinue = decodeTrace(fin, fout, chrome);
+		fout.close();
+	}
+	else
+	{
+		okToContinue = decodeTrace(fin, cout, chrome);
+	}
+	fin.close();
+	
+	return okToContinue ? 1 : -1;
+
+}
+
+/**
+*	Function: decodeTrace
+*	Description: Checks the header of the trace in fin then decodes and formats each of
+*		its records to out. If chrome is set the records are collected into a 
+*		ChromeTrace and written as JSON once the whole trace is read. Returns false if 
+*		the header is wrong or the trace ends in the middle of a record.
+*/
+bool decodeTrace(ifstream& fin, ostream& out, bool chrome)
+{
+
+	char header[Logger::HEADER_SIZE];
+	char record[Logger::RECORD_SIZE];
+	char line[128];
+	LogEvent event;
+	ChromeTrace trace;
+	
+	fin.read(header, Logger::HEADER_SIZE);
+	if (fin.gcount() != Logger::HEADER_SIZE ||
+		memcmp(header, Logger::TRACE_MAGIC, sizeof(Logger::TRACE_MAGIC)) != 0)
+	{
+		cout << "ERROR: File is not a simulator trace" << endl;
+		return 0;
+	}
+	if (header[8] != Logger::RECORD_SIZE)
+	{
+		cout << "ERROR: Trace was written with an unsupported record size" << endl;
+		return 0;
+	}
+	
+	while (fin.read(record, Logger::RECORD_SIZE))
+	{
+		Logger::decodeEvent(record, event);
+		if (chrome)
+		{
+			trace.addEvent(event);
+		}
+		else
+		{
+			out.write(line, Logger::formatEvent(event, line, sizeof(line)));
+		}
+	}
+	if (fin.gcount() != 0)
+	{
+		cout << "ERROR: Trace ends in the middle of a record" << endl;
+		return 0;
+	}
+	
+	if (chrome)
+	{
+		trace.write(out);
+	}
+	
+	return 1;
+
+}
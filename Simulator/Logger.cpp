@@ -0,0 +1,635 @@
+/**
+*	File Name: Logger.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class Logger. Collects the events of
+*		a simulation in a lock-free ring buffer and writes them to the monitor and/or
+*		the log file from a background thread, as text or as a binary trace
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Logger.h"
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+#include <time.h>
+
+const char Logger::TRACE_MAGIC[8] = {'S', 'I', 'M', 'T', 'R', 'A', 'C', 'E'};
+
+/**
+*	Function: Logger
+*	Description: Default constructor for Logger class. Allocates the ring buffer; the
+*		sequence of each slot starts at its index, meaning the slot is free for the
+*		producer that reserves that position.
+*/
+Logger::Logger()
+{
+
+	ring = new Slot[RING_SIZE];
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		ring[i].sequence.store(i, memory_order_relaxed);
+	}
+	enqueuePosition.store(0, memory_order_relaxed);
+	dequeuePosition = 0;
+	running.store(false);
+	stopping.store(false);
+	producers.store(0);
+	binary = false;
+	monitor = NULL;
+	file = NULL;
+	profiler = NULL;
+	pthread_mutex_init(&mutexDirect, NULL);
+
+}
+
+/**
+*	Function: ~Logger
+*	Description: Destructor for Logger class. Writes out any events still waiting in the
+*		ring buffer before freeing it.
+*/
+Logger::~Logger()
+{
+
+	stop();
+	pthread_mutex_destroy(&mutexDirect);
+	delete [] ring;
+
+}
+
+/**
+*	Function: start
+*	Description: Starts the background writer thread. logType is the log type from the
+*		configuration file: 0 logs to monitor, 1 logs to file, 2 logs to both and 3 
+*		writes a binary trace to file (starting with the trace header). Returns false 
+*		if the log type is invalid or the thread could not be created.
+*/
+bool Logger::start(int logType, ostream* monitorSource, ostream* fileSource)
+{
+
+	binary = false;
+	switch (logType)
+	{
+		case 0:
+			monitor = monitorSource;
+			file = NULL;
+		break;
+		case 1:
+			monitor = NULL;
+			file = fileSource;
+		break;
+		case 2:
+			monitor = monitorSource;
+			file = fileSource;
+		break;
+		case 3:
+		{
+			monitor = NULL;
+			file = fileSource;
+			binary = true;
+			char header[HEADER_SIZE];
+			memcpy(header, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+			header[8] = (char) RECORD_SIZE;
+			pthread_mutex_lock(&mutexDirect);
+			write(header, HEADER_SIZE);
+			pthread_mutex_unlock(&mutexDirect);
+		}
+		break;
+		default:
+			cout << "ERROR: Incorrect log type recorded from config file" << endl;
+			return 0;
+	}
+	
+	stopping.store(false);
+	int rc = pthread_create(&writer, NULL, &writerThread, this);
+	if (rc)
+	{
+		cout << "ERROR: return code from pthread_create() is " << rc << endl;
+		return 0;
+	}
+	running.store(true);
+	return 1;
+
+}
+
+/**
+*	Function: stop
+*	Description: Stops the background writer thread once every event in the ring
+*		buffer has been written. Events logged after this are written directly. 
+*		running is cleared under the direct write lock and the ring buffer is drained 
+*		before the lock is released, so an event logged meanwhile is either pushed 
+*		before the drain ends or written directly after it.
+*/
+void Logger::stop()
+{
+
+	if (running.load())
+	{
+		stopping.store(true);
+		pthread_join(writer, NULL);
+	
+		//writing anything pushed while the writer was finishing, until no producer 
+		//that saw the writer running is left
+		pthread_mutex_lock(&mutexDirect);
+		running.store(false);
+		LogEvent event;
+		char line[LINE_SIZE];
+		bool drained = false;
+		while (!drained)
+		{
+			drained = producers.load() == 0;
+			while (pop(event))
+			{
+				deliver(event);
+				write(line, render(event, line));
+			}
+			if (!drained)
+			{
+				sched_yield();
+			}
+		}
+		pthread_mutex_unlock(&mutexDirect);
+	}
+
+}
+
+/**
+*	Function: addSink
+*	Description: Adds sink to the sinks that receive every logged event. Sinks are 
+*		called from the writer thread (or under the direct write lock while the writer 
+*		is stopped), so they never see two events at once.
+*/
+void Logger::addSink(EventSink* sink)
+{
+
+	sinks.push_back(sink);
+
+}
+
+/**
+*	Function: setProfiler
+*	Description: Makes the logger charge the time spent logging events, and writing 
+*		them on the writer thread, to profilerSource
+*/
+void Logger::setProfiler(Profiler* profilerSource)
+{
+
+	profiler = profilerSource;
+
+}
+
+/**
+*	Function: log
+*	Description: Logs an event built from the parameters timestamp, type, pid, device,
+*		unit and address
+*/
+void Logger::log(double timestamp, int type, int pid, int device, int unit,
+				 unsigned int address)
+{
+
+	LogEvent event;
+	event.timestamp = timestamp;
+	event.type = type;
+	event.pid = pid;
+	event.device = device;
+	event.unit = unit;
+	event.address = address;
+	log(event);
+
+}
+
+/**
+*	Function: log
+*	Description: Pushes event onto the ring buffer for the writer thread. Any thread
+*		may log at any time; producers reserve a slot by advancing enqueuePosition and
+*		publish the event by advancing the slot's sequence. If the ring buffer is full
+*		the caller yields until the writer frees a slot. If the writer is not running
+*		the event is formatted and written immediately. A producer is counted in 
+*		producers from before it checks running until it has published, so stop() 
+*		can wait for it.
+*/
+void Logger::log(const LogEvent& event)
+{
+
+	ProfileScope scope(profiler, PROFILE_LOGGING);
+	
+	producers.fetch_add(1);
+	if (!running.load())
+	{
+		producers.fetch_sub(1);
+		char line[LINE_SIZE];
+		int length = render(event, line);
+		pthread_mutex_lock(&mutexDirect);
+		deliver(event);
+		write(line, length);
+		pthread_mutex_unlock(&mutexDirect);
+		return;
+	}
+	
+	unsigned long position = enqueuePosition.load(memory_order_relaxed);
+	Slot* slot;
+	while (true)
+	{
+		slot = &ring[position & (RING_SIZE - 1)];
+		unsigned long sequence = slot->sequence.load(memory_order_acquire);
+		long difference = (long) sequence - (long) position;
+		if (difference == 0)
+		{
+			//slot is free, trying to reserve it
+			if (enqueuePosition.compare_exchange_weak(position, position + 1,
+													  memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (difference < 0)
+		{
+			//ring buffer is full
+			sched_yield();
+			position = enqueuePosition.load(memory_order_relaxed);
+		}
+		else
+		{
+			//another producer took the slot
+			position = enqueuePosition.load(memory_order_relaxed);
+		}
+	}
+	
+	slot->event = event;
+	slot->sequence.store(position + 1, memory_order_release);
+	producers.fetch_sub(1, memory_order_release);
+
+}
+
+/**
+*	Function: addEvent
+*	Description: Logs event, so a logger can take the events of an EventEngine or of 
+*		another logger like any sink
+*/
+void Logger::addEvent(const LogEvent& event)
+{
+
+	log(event);
+
+}
+
+/**
+*	Function: pop
+*	Description: Takes the oldest published event off the ring buffer and stores it in
+*		event. Only called by the single consumer. Returns false if there is no event.
+*/
+bool Logger::pop(LogEvent& event)
+{
+
+	Slot* slot = &ring[dequeuePosition & (RING_SIZE - 1)];
+	unsigned long sequence = slot->sequence.load(memory_order_acquire);
+	if (sequence != dequeuePosition + 1)
+	{
+		return 0;
+	}
+	event = slot->event;
+	slot->sequence.store(dequeuePosition + RING_SIZE, memory_order_release);
+	dequeuePosition++;
+	return 1;
+
+}
+
+/**
+*	Function: writerThread
+*	Description: Entry point for the background writer thread of the logger passed as
+*		parameter
+*/
+void* Logger::writerThread(void* logger)
+{
+
+	((Logger*) logger)->writeEvents();
+	return NULL;
+
+}
+
+/**
+*	Function: writeEvents
+*	Description: Body of the writer thread. Renders up to BATCH_SIZE events at a time
+*		into one buffer and writes the whole batch to the monitor and/or the log file
+*		with a single flush. Sleeps briefly when the ring buffer is empty and returns
+*		once stop() was called and every event has been written.
+*/
+void Logger::writeEvents()
+{
+
+	char* buffer = new char[BATCH_SIZE * LINE_SIZE];
+	struct timespec idle = {0, 200000};
+	
+	while (true)
+	{
+		int length = 0, count = 0;
+		LogEvent event;
+		bool finishing = stopping.load(memory_order_acquire);
+		long long start = profiler != NULL ? Profiler::now() : 0;
+	
+		while (count < BATCH_SIZE && pop(event))
+		{
+			deliver(event);
+			length += render(event, buffer + length);
+			count++;
+		}
+	
+		if (count > 0)
+		{
+			pthread_mutex_lock(&mutexDirect);
+			write(buffer, length);
+			pthread_mutex_unlock(&mutexDirect);
+			if (profiler != NULL)
+			{
+				long long elapsed = Profiler::now() - start;
+				profiler->add(PROFILE_LOG_WRITER, elapsed, elapsed);
+			}
+		}
+		else if (finishing)
+		{
+			break;
+		}
+		else
+		{
+			nanosleep(&idle, NULL);
+		}
+	}
+	
+	delete [] buffer;
+
+}
+
+/**
+*	Function: render
+*	Description: Writes event into buffer, which holds LINE_SIZE characters, in the 
+*		format being logged (a line of text or a binary record). Returns the number of 
+*		characters written.
+*/
+int Logger::render(const LogEvent& event, char* buffer)
+{
+
+	if (binary)
+	{
+		return encodeEvent(event, buffer);
+	}
+	return formatEvent(event, buffer, LINE_SIZE);
+
+}
+
+/**
+*	Function: deliver
+*	Description: Hands event to every sink
+*/
+void Logger::deliver(const LogEvent& event)
+{
+
+	for (int i = 0; i < sinks.size(); i++)
+	{
+		sinks[i]->addEvent(event);
+	}
+
+}
+
+/**
+*	Function: write
+*	Description: Writes length characters of text to the monitor and/or the log file
+*		and flushes them. The caller holds the direct write lock.
+*/
+void Logger::write(const char* text, int length)
+{
+
+	if (monitor != NULL)
+	{
+		monitor->write(text, length);
+		monitor->flush();
+	}
+	if (file != NULL)
+	{
+		file->write(text, length);
+		file->flush();
+	}
+
+}
+
+/**
+*	Function: formatEvent
+*	Description: Formats event as a line of the log (including the newline) into
+*		line, which holds size characters. Returns the length of the line.
+*/
+int Logger::formatEvent(const LogEvent& event, char* line, int size)
+{
+
+	int length;
+	
+	switch (event.type)
+	{
+		case EVENT_SIMULATOR_START:
+			length = snprintf(line, size, "%f - Simulator program starting\n",
+							  event.timestamp);
+		break;
+		case EVENT_SIMULATOR_END:
+			length = snprintf(line, size, "%f - Simulator program ending\n",
+							  event.timestamp);
+		break;
+		case EVENT_PROCESS_PREPARE:
+			length = snprintf(line, size, "%f - OS: preparing process %d\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_PROCESS_START:
+			length = snprintf(line, size, "%f - OS: starting process %d\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_PROCESS_END:
+			length = snprintf(line, size, "%f - End process %d\n", event.timestamp,
+							  event.pid);
+		break;
+		case EVENT_PROCESSING_START:
+			length = snprintf(line, size, "%f - Process %d: start processing action\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_PROCESSING_END:
+			length = snprintf(line, size, "%f - Process %d: end processing action\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_PROCESSING_INTERRUPT:
+			length = snprintf(line, size,
+							  "%f - Process %d: interrupt processing action\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_MEMORY_ALLOCATE_START:
+			length = snprintf(line, size, "%f - Process %d: allocating memory\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_MEMORY_ALLOCATE_END:
+			length = snprintf(line, size,
+							  "%f - Process %d: memory allocated at 0x%08x\n",
+							  event.timestamp, event.pid, event.address);
+		break;
+		case EVENT_MEMORY_BLOCK_START:
+			length = snprintf(line, size, "%f - Process %d: start memory blocking\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_MEMORY_BLOCK_END:
+			length = snprintf(line, size, "%f - Process %d: end memory blocking\n",
+							  event.timestamp, event.pid);
+		break;
+		case EVENT_INPUT_START:
+		case EVENT_OUTPUT_START:
+			if (event.unit >= 0)
+			{
+				length = snprintf(line, size, "%f - Process %d: start %s %s on %s %d\n",
+								  event.timestamp, event.pid,
+								  getDeviceName(event.device),
+								  event.type == EVENT_INPUT_START ? "input" : "output",
+								  getUnitName(event.device), event.unit);
+			}
+			else
+			{
+				length = snprintf(line, size, "%f - Process %d: start %s %s\n",
+								  event.timestamp, event.pid,
+								  getDeviceName(event.device),
+								  event.type == EVENT_INPUT_START ? "input" : "output");
+			}
+		break;
+		case EVENT_INPUT_END:
+		case EVENT_OUTPUT_END:
+			length = snprintf(line, size, "%f - Process %d: end %s %s\n",
+							  event.timestamp, event.pid, getDeviceName(event.device),
+							  event.type == EVENT_INPUT_END ? "input" : "output");
+		break;
+		case EVENT_PROCESS_ARRIVE:
+		case EVENT_PROCESSING_RESUME:
+			//only kept for the metrics, there is no line for them
+			line[0] = '\0';
+			length = 0;
+		break;
+		default:
+			length = snprintf(line, size, "%f - ERROR: unknown event %d\n",
+							  event.timestamp, event.type);
+	}
+	
+	//snprintf returns the length the line would have had if it was cut off
+	if (length >= size)
+	{
+		length = size - 1;
+	}
+	return length;
+
+}
+
+/**
+*	Function: getDeviceName
+*	Description: returns the name of the device with the parameter DeviceId, as it is
+*		written in the meta-data file
+*/
+const char* Logger::getDeviceName(int device)
+{
+
+	switch (device)
+	{
+		case DEVICE_PROCESSOR:
+			return "processor";
+		case DEVICE_MEMORY:
+			return "memory";
+		case DEVICE_HARD_DRIVE:
+			return "hard drive";
+		case DEVICE_KEYBOARD:
+			return "keyboard";
+		case DEVICE_SCANNER:
+			return "scanner";
+		case DEVICE_MONITOR:
+			return "monitor";
+		case DEVICE_PROJECTOR:
+			return "projector";
+		default:
+			return "none";
+	}
+
+}
+
+/**
+*	Function: getUnitName
+*	Description: returns the short name the units of the device with the parameter 
+*		DeviceId are numbered by in the log
+*/
+const char* Logger::getUnitName(int device)
+{
+
+	switch (device)
+	{
+		case DEVICE_KEYBOARD:
+			return "KEYB";
+		case DEVICE_SCANNER:
+			return "SCAN";
+		case DEVICE_MONITOR:
+			return "MON";
+		case DEVICE_PROJECTOR:
+			return "PROJ";
+		default:
+			return "HDD";
+	}
+
+}
+
+/**
+*	Function: encodeEvent
+*	Description: Packs event into the RECORD_SIZE byte binary record stored in record: 
+*		timestamp (8 byte double), pid (4 bytes), event type (1 byte), device (1 byte), 
+*		unit (2 bytes) and address (4 bytes), each in little endian order. Returns 
+*		RECORD_SIZE.
+*/
+int Logger::encodeEvent(const LogEvent& event, char* record)
+{
+
+	unsigned long long timestamp;
+	unsigned char* bytes = (unsigned char*) record;
+	
+	memcpy(&timestamp, &event.timestamp, sizeof(timestamp));
+	for (int i = 0; i < 8; i++)
+	{
+		bytes[i] = (unsigned char) (timestamp >> (8 * i));
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		bytes[8 + i] = (unsigned char) ((unsigned int) event.pid >> (8 * i));
+		bytes[16 + i] = (unsigned char) (event.address >> (8 * i));
+	}
+	bytes[12] = (unsigned char) event.type;
+	bytes[13] = (unsigned char) event.device;
+	bytes[14] = (unsigned char) event.unit;
+	bytes[15] = (unsigned char) ((unsigned int) event.unit >> 8);
+	
+	return RECORD_SIZE;
+
+}
+
+/**
+*	Function: decodeEvent
+*	Description: Unpacks the binary record stored in record (see encodeEvent) into 
+*		event
+*/
+void Logger::decodeEvent(const char* record, LogEvent& event)
+{
+
+	unsigned long long timestamp = 0;
+	unsigned int pid = 0, address = 0;
+	const unsigned char* bytes = (const unsigned char*) record;
+	
+	for (int i = 0; i < 8; i++)
+	{
+		timestamp |= (unsigned long long) bytes[i] << (8 * i);
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		pid |= (unsigned int) bytes[8 + i] << (8 * i);
+		address |= (unsigned int) bytes[16 + i] << (8 * i);
+	}
+	memcpy(&event.timestamp, &timestamp, sizeof(timestamp));
+	event.pid = (int) pid;
+	event.type = bytes[12];
+	event.device = bytes[13];
+	event.unit = (short) (bytes[14] | (bytes[15] << 8));
+	event.address = address;
+
+}
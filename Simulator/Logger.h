@@ -0,0 +1,133 @@
+/**
+*	File Name: Logger.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class Logger. Collects the events of a
+*		simulation in a lock-free ring buffer and writes them to the monitor and/or the
+*		log file from a background thread, as text or as a binary trace
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef LOGGER_
+#define LOGGER_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <pthread.h>
+#include "Config.h"
+#include "Profiler.h"
+
+using namespace std;
+
+//types of events logged by the simulation
+enum EventType
+{
+	EVENT_SIMULATOR_START, EVENT_SIMULATOR_END,
+	EVENT_PROCESS_PREPARE, EVENT_PROCESS_START, EVENT_PROCESS_END,
+	EVENT_PROCESSING_START, EVENT_PROCESSING_END, EVENT_PROCESSING_INTERRUPT,
+	EVENT_MEMORY_ALLOCATE_START, EVENT_MEMORY_ALLOCATE_END,
+	EVENT_MEMORY_BLOCK_START, EVENT_MEMORY_BLOCK_END,
+	EVENT_INPUT_START, EVENT_INPUT_END, EVENT_OUTPUT_START, EVENT_OUTPUT_END,
+	EVENT_PROCESS_ARRIVE, EVENT_PROCESSING_RESUME, //not part of the text log
+	EVENT_TYPE_COUNT
+};
+
+//a single logged event, kept small so that logging only copies a few words
+struct LogEvent
+{
+	double timestamp; //seconds since the start of the simulation
+	int type; //EventType
+	int pid;
+	int device; //DeviceId of the device used, DEVICE_NONE if none
+	int unit; //index of the device unit (HDD or PROJ), -1 if not shown
+	unsigned int address; //memory address of an allocation
+};
+
+//receives every logged event from the writer thread, one event at a time
+class EventSink
+{
+
+	public:
+	
+		virtual ~EventSink() {}
+		virtual void addEvent(const LogEvent&) = 0;
+	
+};
+
+class Logger : public EventSink
+{
+
+	//Logger class public declarations
+	public:
+	
+		Logger();
+		~Logger();
+	
+		bool start(int, ostream*, ostream*);
+		void stop();
+		void addSink(EventSink*);
+		void setProfiler(Profiler*);
+	
+		void log(double, int, int = 0, int = DEVICE_NONE, int = -1, unsigned int = 0);
+		void log(const LogEvent&);
+		void addEvent(const LogEvent&);
+	
+		static int formatEvent(const LogEvent&, char*, int);
+		static const char* getDeviceName(int);
+		static const char* getUnitName(int);
+	
+		static int encodeEvent(const LogEvent&, char*);
+		static void decodeEvent(const char*, LogEvent&);
+	
+		//binary traces start with TRACE_MAGIC followed by the record size as a 
+		//byte, every record after that is RECORD_SIZE bytes (little endian)
+		static const char TRACE_MAGIC[8];
+		static const int HEADER_SIZE = 9;
+		static const int RECORD_SIZE = 20;
+	
+	//Logger class private declarations
+	private:
+	
+		//slot of the ring buffer, sequence tells producers and the consumer whose
+		//turn it is to use the slot
+		struct Slot
+		{
+			atomic<unsigned long> sequence;
+			LogEvent event;
+		};
+	
+		static void* writerThread(void*);
+		void writeEvents();
+		bool pop(LogEvent&);
+		int render(const LogEvent&, char*);
+		void deliver(const LogEvent&);
+		void write(const char*, int);
+	
+		static const int RING_SIZE = 4096; //must be a power of two
+		static const int BATCH_SIZE = 256; //events formatted before each write
+		static const int LINE_SIZE = 128; //longest formatted event
+	
+		Slot* ring;
+		atomic<unsigned long> enqueuePosition;
+		unsigned long dequeuePosition;
+	
+		atomic<bool> running, stopping;
+		atomic<int> producers; //threads between checking running and publishing
+		bool binary; //events are written as binary records instead of text
+		pthread_t writer;
+		pthread_mutex_t mutexDirect;
+	
+		ostream* monitor;
+		ostream* file;
+		vector<EventSink*> sinks;
+		Profiler* profiler; //times logging calls and writes, NULL if not profiled
+	
+};
+
+#endif
@@ -10,6 +10,13 @@
 
 #include "MetaData.h"
 
+//the gather kernel is compiled for AVX2 on its own and only used if the processor 
+//running the simulator has it, see calculateTotalTimes()
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GATHER_TOTAL_TIMES
+#include <immintrin.h>
+#endif
+
 /**
 *	Function: MetaData
 *	Description: Default constructor for MetaData class
@@ -17,6 +24,9 @@
 MetaData::MetaData()
 {
 
+	deviceId = DEVICE_NONE;
+	blockAddress = -1;
+
 }
 
 /**
@@ -31,6 +41,8 @@ MetaData::MetaData(char codeSource, string descriptorSource, int cycleSource)
 	code = codeSource;
 	descriptor = descriptorSource;
 	numOfCycles = cycleSource;
+	deviceId = findDeviceId();
+	blockAddress = -1;
 
 }
 
@@ -268,10 +280,33 @@ bool MetaData::parseMetaData(string instruction)
 	begLocation = descriptorLength + 3;
 	i = begLocation;
 	//loop runs until either terminator is hit (';' or '.')
-	while (instruction[i] != ';' && instruction[i] != '.')
+	while (instruction[i] != ';' && instruction[i] != '.' && instruction[i] != '@')
 	{
 		i++;
 	}
+	
+	//hard drive instructions may name the block they use after the cycles
+	blockAddress = -1;
+	if (instruction[i] == '@')
+	{
+		if (descriptor != "hard drive")
+		{
+			cout << "ERROR: Block address given for a device other than hard drive" 
+				 << endl;
+			return 0;
+		}
+		int j = i + 1;
+		while (instruction[j] >= '0' && instruction[j] <= '9' && j - i <= 9)
+		{
+			j++;
+		}
+		if (j == i + 1 || (instruction[j] != ';' && instruction[j] != '.'))
+		{
+			cout << "ERROR: Invalid block address" << endl;
+			return 0;
+		}
+		blockAddress = atoi(instruction.substr(i + 1, j - i - 1).c_str());
+	}
 	if ((i - begLocation) > 2)
 	{
 		//checking if number of cycles exceeds two characters, considered to be invalid 
@@ -297,6 +332,7 @@ bool MetaData::parseMetaData(string instruction)
 		return 0;
 	}
 	numOfCycles = parsedNumOfCycles;
+	deviceId = findDeviceId();
 	
 	return 1;
 
@@ -316,6 +352,173 @@ void MetaData::calculateTotalTime(Config configData)
 
 }
 
+/**
+*	Function: findDeviceId
+*	Description: returns the DeviceId of the device this instruction uses
+*/
+int MetaData::findDeviceId()
+{
+
+	return lookupDeviceId(code, descriptor);
+
+}
+
+/**
+*	Function: lookupDeviceId
+*	Description: Uses the relationship between the meta-data code and the meta-data 
+*		descriptor to find the DeviceId of the device an instruction uses. Returns 
+*		DEVICE_NONE if the instruction does not use a device.
+*/
+int MetaData::lookupDeviceId(char code, string descriptor)
+{
+
+	if (code == 'P')
+	{
+		return DEVICE_PROCESSOR;
+	}
+	else if (code == 'M')
+	{
+		return DEVICE_MEMORY;
+	}
+	else if (code == 'I' || code == 'O')
+	{
+		if (descriptor == "hard drive")
+		{
+			return DEVICE_HARD_DRIVE;
+		}
+		else if (descriptor == "keyboard")
+		{
+			return DEVICE_KEYBOARD;
+		}
+		else if (descriptor == "scanner")
+		{
+			return DEVICE_SCANNER;
+		}
+		else if (descriptor == "monitor")
+		{
+			return DEVICE_MONITOR;
+		}
+		else if (descriptor == "projector")
+		{
+			return DEVICE_PROJECTOR;
+		}
+	}
+	return DEVICE_NONE;
+
+}
+
+/**
+*	Function: buildArrays
+*	Description: Copies the device id, number of cycles and total time of every 
+*		instruction in instructionSet into the structure-of-arrays arrays. Every 
+*		instruction from an application begin up to the next application begin 
+*		belongs to the same process; instructions before the first application begin 
+*		and system instructions belong to no process.
+*/
+void MetaData::buildArrays(deque<MetaData>& instructionSet, InstructionArrays& arrays)
+{
+
+	int count = instructionSet.size();
+	int processId = -1;
+	
+	arrays.deviceIds.resize(count);
+	arrays.cycles.resize(count);
+	arrays.totalTimes.resize(count);
+	arrays.processIds.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		if (instructionSet[i].code == 'A' && instructionSet[i].descriptor == "begin")
+		{
+			processId++;
+		}
+		arrays.deviceIds[i] = instructionSet[i].deviceId;
+		arrays.cycles[i] = instructionSet[i].numOfCycles;
+		arrays.totalTimes[i] = instructionSet[i].totalTime;
+		arrays.processIds[i] = instructionSet[i].code == 'S' ? -1 : processId;
+	}
+	arrays.processCount = processId + 1;
+
+}
+
+#if defined(GATHER_TOTAL_TIMES)
+/**
+*	Function: gatherTotalTimes
+*	Description: AVX2 kernel of calculateTotalTimes(). Looks up the cycle time of 
+*		eight instructions at a time with a gather and multiplies them by their 
+*		cycles, for as many whole groups of eight as count holds. Returns the number 
+*		of instructions calculated. Must only be called if the processor has AVX2.
+*/
+__attribute__((target("avx2")))
+static int gatherTotalTimes(const int* deviceTimes, const int* ids, const int* cycles,
+							int* totals, int count)
+{
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256i idVector = _mm256_loadu_si256((const __m256i*) (ids + i));
+		__m256i cycleVector = _mm256_loadu_si256((const __m256i*) (cycles + i));
+		__m256i timeVector = _mm256_i32gather_epi32(deviceTimes, idVector, 4);
+		_mm256_storeu_si256((__m256i*) (totals + i), 
+							_mm256_mullo_epi32(timeVector, cycleVector));
+	}
+	return i;
+
+}
+#endif
+
+/**
+*	Function: calculateTotalTimes
+*	Description: Bulk version of calculateTotalTime(). Calculates the total time of 
+*		every instruction in arrays at once by looking up the cycle time of each device 
+*		in deviceTimes (a table indexed by DeviceId, see Config::getDeviceTimeTable) 
+*		and multiplying it by the number of cycles. On a processor with AVX2 the 
+*		lookups and multiplications are done eight instructions at a time by 
+*		gatherTotalTimes(), whatever the simulator was built for; the rest are done 
+*		one at a time.
+*/
+void MetaData::calculateTotalTimes(const int* deviceTimes, InstructionArrays& arrays)
+{
+
+	int count = arrays.deviceIds.size();
+	arrays.totalTimes.resize(count);
+	const int* ids = arrays.deviceIds.data();
+	const int* cycles = arrays.cycles.data();
+	int* totals = arrays.totalTimes.data();
+	int i = 0;
+	
+#if defined(GATHER_TOTAL_TIMES)
+	if (__builtin_cpu_supports("avx2"))
+	{
+		i = gatherTotalTimes(deviceTimes, ids, cycles, totals, count);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		totals[i] = deviceTimes[ids[i]] * cycles[i];
+	}
+
+}
+
+/**
+*	Function: sumProcessTimes
+*	Description: Adds up the total times in arrays for each process. processTimes gets 
+*		one entry per process holding the estimated time of that process.
+*/
+void MetaData::sumProcessTimes(InstructionArrays& arrays, vector<int>& processTimes)
+{
+
+	processTimes.assign(arrays.processCount, 0);
+	for (int i = 0; i < arrays.totalTimes.size(); i++)
+	{
+		if (arrays.processIds[i] >= 0)
+		{
+			processTimes[arrays.processIds[i]] += arrays.totalTimes[i];
+		}
+	}
+
+}
+
 /**
 *	Function: getCode
 *	Description: returns the meta-data code for this instruction
@@ -349,6 +552,18 @@ int MetaData::getNumOfCycles()
 
 }
 
+/**
+*	Function: getBlockAddress
+*	Description: returns the hard drive block this instruction uses, -1 if it names 
+*		none
+*/
+int MetaData::getBlockAddress()
+{
+
+	return blockAddress;
+
+}
+
 /**
 *	Function: getTotalTime
 *	Description: returns the total amount of time this instruction will take to perform
@@ -360,6 +575,17 @@ int MetaData::getTotalTime()
 
 }
 
+/**
+*	Function: getDeviceId
+*	Description: returns the DeviceId of the device this instruction uses
+*/
+int MetaData::getDeviceId()
+{
+
+	return deviceId;
+
+}
+
 /**
 *	Function: setData
 *	Description: sets the data to the parameters: codeSource, descriptorSource,
@@ -373,6 +599,7 @@ void MetaData::setData(char codeSource, string descriptorSource, int cycleSource
 	descriptor = descriptorSource;
 	numOfCycles = cycleSource;
 	totalTime = totalTimeSource;
+	deviceId = findDeviceId();
 
 }
 
@@ -384,6 +611,7 @@ void MetaData::setCode(char codeSource)
 {
 
 	code = codeSource;
+	deviceId = findDeviceId();
 
 }
 
@@ -395,6 +623,7 @@ void MetaData::setDescriptor(string descriptorSource)
 {
 
 	descriptor = descriptorSource;
+	deviceId = findDeviceId();
 
 }
 
@@ -409,6 +638,17 @@ void MetaData::setNumOfCycles(int cycleSource)
 
 }
 
+/**
+*	Function: setBlockAddress
+*	Description: sets the blockAddress to the parameter: blockSource
+*/
+void MetaData::setBlockAddress(int blockSource)
+{
+
+	blockAddress = blockSource;
+
+}
+
 /**
 *	Function: setTotalTime
 *	Description: sets the totalTime to the parameter: totalTimeSource
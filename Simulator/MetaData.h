@@ -16,10 +16,21 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <deque>
+#include <vector>
 #include "Config.h"
 
 using namespace std;
 
+//structure-of-arrays form of a set of instructions, used to calculate the total time 
+//of every instruction at once
+struct InstructionArrays
+{
+	vector<int> deviceIds, cycles, totalTimes;
+	vector<int> processIds; //index of the process of each instruction, -1 for none
+	int processCount;
+};
+
 class MetaData
 {
 
@@ -35,17 +46,26 @@ class MetaData
 		
 		bool parseMetaData(string);
 		void calculateTotalTime(Config);
+		int findDeviceId();
+		static int lookupDeviceId(char, string);
+		
+		static void buildArrays(deque<MetaData>&, InstructionArrays&);
+		static void calculateTotalTimes(const int*, InstructionArrays&);
+		static void sumProcessTimes(InstructionArrays&, vector<int>&);
 		
 		char getCode();
 		string getDescriptor();
 		int getNumOfCycles();
 		int getTotalTime();
+		int getDeviceId();
+		int getBlockAddress();
 		
 		void setData(char, string, int, int);
 		void setCode(char);
 		void setDescriptor(string);
 		void setNumOfCycles(int);
 		void setTotalTime(int);
+		void setBlockAddress(int);
 		
 		void print();
 	
@@ -69,6 +89,8 @@ class MetaData
 		char code;
 		string descriptor;
 		int numOfCycles, totalTime;
+		int deviceId; //DeviceId of the code and descriptor, kept up to date by setters
+		int blockAddress; //hard drive block given as "cycles@block", -1 if none
 
 };
 
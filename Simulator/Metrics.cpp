@@ -0,0 +1,369 @@
+/**
+*	File Name: Metrics.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class Metrics. Follows the logged
+*		events of a simulation to measure the arrival, first dispatch, completion,
+*		processor time, I/O time and ready queue wait of each process, then reports
+*		them per process and as aggregate statistics
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Metrics.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+/**
+*	Function: Metrics
+*	Description: Default constructor for Metrics class
+*/
+Metrics::Metrics()
+{
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every measurement and prepares for a program of processCount
+*		processes
+*/
+void Metrics::reset(int processCount)
+{
+
+	ProcessMetrics empty = {};
+	
+	processes.assign(processCount, empty);
+	for (int i = 0; i < processCount; i++)
+	{
+		processes[i].pid = i + 1;
+	}
+
+}
+
+/**
+*	Function: addEvent
+*	Description: Updates the measurements of the process of event. The first time a
+*		process is started counts as its first dispatch. Processor time runs from the
+*		start (or resume) of a processing action to its end or interrupt, I/O and 
+*		memory time from the start to the end of each action.
+*/
+void Metrics::addEvent(const LogEvent& event)
+{
+
+	ProcessMetrics* process = getProcess(event.pid);
+	if (process == NULL)
+	{
+		return;
+	}
+	if (event.timestamp > process->lastActivity)
+	{
+		process->lastActivity = event.timestamp;
+	}
+	
+	switch (event.type)
+	{
+		case EVENT_PROCESS_ARRIVE:
+			process->arrival = event.timestamp;
+			process->arrived = true;
+		break;
+		case EVENT_PROCESS_START:
+			if (!process->dispatched)
+			{
+				process->firstDispatch = event.timestamp;
+				process->dispatched = true;
+			}
+		break;
+		case EVENT_PROCESS_END:
+			process->completion = event.timestamp;
+			process->completed = true;
+		break;
+		case EVENT_PROCESSING_START:
+		case EVENT_PROCESSING_RESUME:
+			process->cpuStart = event.timestamp;
+		break;
+		case EVENT_PROCESSING_END:
+		case EVENT_PROCESSING_INTERRUPT:
+			process->cpuTime += event.timestamp - process->cpuStart;
+		break;
+		case EVENT_MEMORY_ALLOCATE_START:
+		case EVENT_MEMORY_BLOCK_START:
+			process->memoryStart = event.timestamp;
+		break;
+		case EVENT_MEMORY_ALLOCATE_END:
+		case EVENT_MEMORY_BLOCK_END:
+			process->memoryTime += event.timestamp - process->memoryStart;
+		break;
+		case EVENT_INPUT_START:
+		case EVENT_OUTPUT_START:
+			process->ioStart = event.timestamp;
+		break;
+		case EVENT_INPUT_END:
+		case EVENT_OUTPUT_END:
+			process->ioTime += event.timestamp - process->ioStart;
+		break;
+	}
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the metrics of every process followed by the mean, p50, p95,
+*		p99 and maximum turnaround, waiting and response time over the completed
+*		processes and the throughput over programDuration seconds to out
+*/
+void Metrics::print(ostream& out, double programDuration)
+{
+
+	char line[128];
+	
+	out << endl << "Process Metrics (seconds)" << endl;
+	snprintf(line, sizeof(line), "%4s %10s %10s %10s %10s %10s %10s\n", "pid",
+			 "arrival", "response", "turnaround", "waiting", "processor", "i/o");
+	out << line;
+	for (int i = 0; i < processes.size(); i++)
+	{
+		if (!processes[i].completed)
+		{
+			snprintf(line, sizeof(line), "%4d did not complete\n", processes[i].pid);
+		}
+		else
+		{
+			snprintf(line, sizeof(line), "%4d %10.6f %10.6f %10.6f %10.6f %10.6f %10.6f\n",
+					 processes[i].pid, processes[i].arrival, getResponse(i),
+					 getTurnaround(i), getWaiting(i), processes[i].cpuTime,
+					 processes[i].ioTime);
+		}
+		out << line;
+	}
+	
+	MetricStats stats[3] = {getTurnaroundStats(), getWaitingStats(),
+							getResponseStats()};
+	const char* names[3] = {"turnaround", "waiting", "response"};
+	
+	out << endl << "Aggregate Metrics (seconds)" << endl;
+	snprintf(line, sizeof(line), "%10s %10s %10s %10s %10s %10s\n", "", "mean", "p50",
+			 "p95", "p99", "max");
+	out << line;
+	for (int i = 0; i < 3; i++)
+	{
+		snprintf(line, sizeof(line), "%10s %10.6f %10.6f %10.6f %10.6f %10.6f\n",
+				 names[i], stats[i].mean, stats[i].p50, stats[i].p95, stats[i].p99,
+				 stats[i].max);
+		out << line;
+	}
+	
+	int completed = getCompletedCount();
+	snprintf(line, sizeof(line), "Throughput = %d processes in %f s (%f processes/s)\n",
+			 completed, programDuration,
+			 programDuration > 0 ? completed / programDuration : 0.0);
+	out << line << endl;
+
+}
+
+/**
+*	Function: save
+*	Description: Writes the measurements of every process to checkpoint, so a run 
+*		restored from a checkpoint reports the part it did not run itself
+*/
+void Metrics::save(CheckpointWriter& checkpoint)
+{
+
+	checkpoint.putInt(processes.size());
+	for (int i = 0; i < processes.size(); i++)
+	{
+		ProcessMetrics& process = processes[i];
+		double times[] = {process.arrival, process.firstDispatch, process.completion,
+						  process.lastActivity, process.cpuTime, process.ioTime,
+						  process.memoryTime, process.cpuStart, process.ioStart,
+						  process.memoryStart};
+		for (int j = 0; j < 10; j++)
+		{
+			checkpoint.putDouble(times[j]);
+		}
+		checkpoint.putInt(process.arrived);
+		checkpoint.putInt(process.dispatched);
+		checkpoint.putInt(process.completed);
+	}
+
+}
+
+/**
+*	Function: restore
+*	Description: Reads the measurements written by save() from checkpoint in place of 
+*		the current ones. Returns false if the checkpoint is not good.
+*/
+bool Metrics::restore(CheckpointReader& checkpoint)
+{
+
+	reset(checkpoint.getCount());
+	for (int i = 0; checkpoint.isGood() && i < processes.size(); i++)
+	{
+		ProcessMetrics& process = processes[i];
+		double* times[] = {&process.arrival, &process.firstDispatch,
+						   &process.completion, &process.lastActivity,
+						   &process.cpuTime, &process.ioTime, &process.memoryTime,
+						   &process.cpuStart, &process.ioStart, &process.memoryStart};
+		for (int j = 0; j < 10; j++)
+		{
+			*times[j] = checkpoint.getDouble();
+		}
+		process.arrived = checkpoint.getInt(0, 1);
+		process.dispatched = checkpoint.getInt(0, 1);
+		process.completed = checkpoint.getInt(0, 1);
+	}
+	
+	return checkpoint.isGood();
+
+}
+
+/**
+*	Function: getCompletedCount
+*	Description: returns the number of processes that completed
+*/
+int Metrics::getCompletedCount()
+{
+
+	int count = 0;
+	for (int i = 0; i < processes.size(); i++)
+	{
+		if (processes[i].completed)
+		{
+			count++;
+		}
+	}
+	return count;
+
+}
+
+/**
+*	Function: getTurnaround
+*	Description: returns the time from arrival to completion of the process at index. 
+*		Device threads can finish an I/O action after the process has ended, so the 
+*		process completes with whichever of the two comes last.
+*/
+double Metrics::getTurnaround(int index)
+{
+
+	double completion = processes[index].completion;
+	if (processes[index].lastActivity > completion)
+	{
+		completion = processes[index].lastActivity;
+	}
+	return completion - processes[index].arrival;
+
+}
+
+/**
+*	Function: getResponse
+*	Description: returns the time from arrival to first dispatch of the process at
+*		index
+*/
+double Metrics::getResponse(int index)
+{
+
+	return processes[index].firstDispatch - processes[index].arrival;
+
+}
+
+/**
+*	Function: getWaiting
+*	Description: returns the time the process at index spent in the ready queue, which
+*		is its turnaround time less the time it spent on the processor, on I/O and on
+*		memory actions
+*/
+double Metrics::getWaiting(int index)
+{
+
+	double waiting = getTurnaround(index) - processes[index].cpuTime -
+					 processes[index].ioTime - processes[index].memoryTime;
+	return waiting > 0 ? waiting : 0;
+
+}
+
+/**
+*	Function: getTurnaroundStats
+*	Description: returns the statistics of the turnaround time of completed processes
+*/
+MetricStats Metrics::getTurnaroundStats()
+{
+
+	return calculateStats(&Metrics::getTurnaround);
+
+}
+
+/**
+*	Function: getResponseStats
+*	Description: returns the statistics of the response time of completed processes
+*/
+MetricStats Metrics::getResponseStats()
+{
+
+	return calculateStats(&Metrics::getResponse);
+
+}
+
+/**
+*	Function: getWaitingStats
+*	Description: returns the statistics of the waiting time of completed processes
+*/
+MetricStats Metrics::getWaitingStats()
+{
+
+	return calculateStats(&Metrics::getWaiting);
+
+}
+
+/**
+*	Function: calculateStats
+*	Description: Calculates the mean, nearest-rank percentiles and maximum of metric
+*		over every completed process. Every statistic is 0 if no process completed.
+*/
+MetricStats Metrics::calculateStats(double (Metrics::*metric)(int))
+{
+
+	MetricStats stats = {};
+	vector<double> values;
+	double total = 0;
+	
+	for (int i = 0; i < processes.size(); i++)
+	{
+		if (processes[i].completed)
+		{
+			values.push_back((this->*metric)(i));
+			total += values.back();
+		}
+	}
+	if (values.empty())
+	{
+		return stats;
+	}
+	
+	sort(values.begin(), values.end());
+	int count = values.size();
+	stats.mean = total / count;
+	stats.p50 = values[(int) ceil(0.50 * count) - 1];
+	stats.p95 = values[(int) ceil(0.95 * count) - 1];
+	stats.p99 = values[(int) ceil(0.99 * count) - 1];
+	stats.max = values[count - 1];
+	
+	return stats;
+
+}
+
+/**
+*	Function: getProcess
+*	Description: returns the measurements of the process with pid, NULL if there is no
+*		such process
+*/
+ProcessMetrics* Metrics::getProcess(int pid)
+{
+
+	if (pid < 1 || pid > processes.size())
+	{
+		return NULL;
+	}
+	return &processes[pid - 1];
+
+}
@@ -0,0 +1,76 @@
+/**
+*	File Name: Metrics.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class Metrics. Follows the logged events of a
+*		simulation to measure the arrival, first dispatch, completion, processor time,
+*		I/O time and ready queue wait of each process, then reports them per process
+*		and as aggregate statistics
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef METRICS_
+#define METRICS_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <vector>
+#include "Logger.h"
+#include "Checkpoint.h"
+
+using namespace std;
+
+//times measured for a single process, in seconds since the start of the simulation
+struct ProcessMetrics
+{
+	int pid;
+	double arrival, firstDispatch, completion;
+	double lastActivity; //time of the last event, I/O can end after the process
+	double cpuTime, ioTime, memoryTime;
+	bool arrived, dispatched, completed;
+
+	//start of the processing, I/O or memory action currently running
+	double cpuStart, ioStart, memoryStart;
+};
+
+//mean, percentiles and maximum of one metric over every completed process
+struct MetricStats
+{
+	double mean, p50, p95, p99, max;
+};
+
+class Metrics : public EventSink
+{
+
+	//Metrics class public declarations
+	public:
+
+		Metrics();
+
+		void reset(int);
+		void addEvent(const LogEvent&);
+		void print(ostream&, double);
+		void save(CheckpointWriter&);
+		bool restore(CheckpointReader&);
+
+		int getCompletedCount();
+		double getTurnaround(int);
+		double getResponse(int);
+		double getWaiting(int);
+		MetricStats getTurnaroundStats();
+		MetricStats getResponseStats();
+		MetricStats getWaitingStats();
+
+	//Metrics class private declarations
+	private:
+
+		MetricStats calculateStats(double (Metrics::*)(int));
+		ProcessMetrics* getProcess(int);
+
+		vector<ProcessMetrics> processes; //indexed by pid - 1
+
+};
+
+#endif
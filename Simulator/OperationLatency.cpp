@@ -0,0 +1,170 @@
+/**
+*	File Name: OperationLatency.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class OperationLatency. Keeps a
+*		latency histogram of how far each kind of operation ran over its planned time
+*		and of how long it queued for its device
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "OperationLatency.h"
+#include <stdio.h>
+
+/**
+*	Function: OperationLatency
+*	Description: Default constructor for OperationLatency class
+*/
+OperationLatency::OperationLatency()
+{
+
+	for (int i = 0; i < OPERATION_COUNT; i++)
+	{
+		earlyCounts[i].store(0);
+	}
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every recorded operation. Must not be called while
+*		operations are being recorded.
+*/
+void OperationLatency::reset()
+{
+
+	for (int i = 0; i < OPERATION_COUNT; i++)
+	{
+		overruns[i].reset();
+		queueDelays[i].reset();
+		earlyCounts[i].store(0);
+	}
+
+}
+
+/**
+*	Function: record
+*	Description: Records an operation of type that did not queue. planned and observed
+*		are its planned and actual running time in seconds.
+*/
+void OperationLatency::record(int type, double planned, double observed)
+{
+
+	double overrun = observed - planned;
+	if (overrun < 0)
+	{
+		//finished early, counted on its own so the histogram only holds overruns
+		earlyCounts[type].fetch_add(1, memory_order_relaxed);
+		overrun = 0;
+	}
+	overruns[type].record((unsigned long long) (overrun * 1000000));
+
+}
+
+/**
+*	Function: record
+*	Description: Records an operation of type that queued for queued seconds before
+*		running. planned and observed are its planned and actual running time in
+*		seconds.
+*/
+void OperationLatency::record(int type, double planned, double observed, double queued)
+{
+
+	record(type, planned, observed);
+	queueDelays[type].record((unsigned long long) (queued > 0 ? queued * 1000000 : 0));
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the count, number finished early, mean, p50, p90, p99, p99.9
+*		and maximum overrun of each operation type, then the same statistics for the
+*		queueing delay of the operations that use a device, to out
+*/
+void OperationLatency::print(ostream& out)
+{
+
+	char line[160];
+	
+	out << endl << "Operation Overrun (milliseconds past the planned time)" << endl;
+	snprintf(line, sizeof(line), "%-18s %8s %8s %9s %9s %9s %9s %9s %9s\n",
+			 "operation", "count", "early", "mean", "p50", "p90", "p99", "p99.9",
+			 "max");
+	out << line;
+	for (int i = 0; i < OPERATION_COUNT; i++)
+	{
+		LatencyHistogram::Snapshot snapshot = overruns[i].merge();
+		if (snapshot.count == 0)
+		{
+			continue;
+		}
+		snprintf(line, sizeof(line),
+				 "%-18s %8llu %8llu %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+				 getOperationName(i), snapshot.count, earlyCounts[i].load(),
+				 snapshot.getMean() / 1000, snapshot.getValueAtPercentile(50) / 1000.0,
+				 snapshot.getValueAtPercentile(90) / 1000.0,
+				 snapshot.getValueAtPercentile(99) / 1000.0,
+				 snapshot.getValueAtPercentile(99.9) / 1000.0,
+				 snapshot.getMax() / 1000.0);
+		out << line;
+	}
+	
+	out << endl << "Operation Queueing Delay (milliseconds)" << endl;
+	snprintf(line, sizeof(line), "%-18s %8s %9s %9s %9s %9s %9s %9s\n", "operation",
+			 "count", "mean", "p50", "p90", "p99", "p99.9", "max");
+	out << line;
+	for (int i = 0; i < OPERATION_COUNT; i++)
+	{
+		LatencyHistogram::Snapshot snapshot = queueDelays[i].merge();
+		if (snapshot.count == 0)
+		{
+			continue;
+		}
+		snprintf(line, sizeof(line),
+				 "%-18s %8llu %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+				 getOperationName(i), snapshot.count, snapshot.getMean() / 1000,
+				 snapshot.getValueAtPercentile(50) / 1000.0,
+				 snapshot.getValueAtPercentile(90) / 1000.0,
+				 snapshot.getValueAtPercentile(99) / 1000.0,
+				 snapshot.getValueAtPercentile(99.9) / 1000.0,
+				 snapshot.getMax() / 1000.0);
+		out << line;
+	}
+	out << endl;
+
+}
+
+/**
+*	Function: getOperationName
+*	Description: returns the name of the operation type, as its meta-data code and
+*		descriptor
+*/
+const char* OperationLatency::getOperationName(int type)
+{
+
+	switch (type)
+	{
+		case OPERATION_PROCESSOR:
+			return "P{run}";
+		case OPERATION_MEMORY_ALLOCATE:
+			return "M{allocate}";
+		case OPERATION_MEMORY_BLOCK:
+			return "M{block}";
+		case OPERATION_HARD_DRIVE_INPUT:
+			return "I{hard drive}";
+		case OPERATION_KEYBOARD_INPUT:
+			return "I{keyboard}";
+		case OPERATION_SCANNER_INPUT:
+			return "I{scanner}";
+		case OPERATION_HARD_DRIVE_OUTPUT:
+			return "O{hard drive}";
+		case OPERATION_MONITOR_OUTPUT:
+			return "O{monitor}";
+		case OPERATION_PROJECTOR_OUTPUT:
+			return "O{projector}";
+		default:
+			return "unknown";
+	}
+
+}
@@ -0,0 +1,56 @@
+/**
+*	File Name: OperationLatency.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class OperationLatency. Keeps a latency
+*		histogram of how far each kind of operation ran over its planned time and of
+*		how long it queued for its device
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef OPERATION_LATENCY_
+#define OPERATION_LATENCY_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <atomic>
+#include "LatencyHistogram.h"
+
+using namespace std;
+
+//kinds of operations handled by Simulator::handleProcess()
+enum OperationType
+{
+	OPERATION_PROCESSOR, OPERATION_MEMORY_ALLOCATE, OPERATION_MEMORY_BLOCK,
+	OPERATION_HARD_DRIVE_INPUT, OPERATION_KEYBOARD_INPUT, OPERATION_SCANNER_INPUT,
+	OPERATION_HARD_DRIVE_OUTPUT, OPERATION_MONITOR_OUTPUT, OPERATION_PROJECTOR_OUTPUT,
+	OPERATION_COUNT
+};
+
+class OperationLatency
+{
+
+	//OperationLatency class public declarations
+	public:
+
+		OperationLatency();
+
+		void reset();
+		void record(int, double, double);
+		void record(int, double, double, double);
+		void print(ostream&);
+
+		static const char* getOperationName(int);
+
+	//OperationLatency class private declarations
+	private:
+
+		LatencyHistogram overruns[OPERATION_COUNT];
+		LatencyHistogram queueDelays[OPERATION_COUNT];
+		atomic<unsigned long long> earlyCounts[OPERATION_COUNT];
+
+};
+
+#endif
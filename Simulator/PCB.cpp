@@ -18,12 +18,16 @@ PCB::PCB()
 {
 
 	processState = 0;
+	interruptHasOccurred = false;
 	blockCount = 0;
 	lastAddress = 0;
 	hardDriveQuant = 0;
-	hardDrivesUsed = 0;
 	projectorQuant = 0;
-	projectorsUsed = 0;
+	estimatedProcessTime = 0;
+	for (int i = 0; i < DEVICE_COUNT; i++)
+	{
+		devicesUsed[i] = 0;
+	}
 
 }
 
@@ -37,6 +41,7 @@ PCB::PCB(int pidSource)
 {
 
 	processState = 0;
+	interruptHasOccurred = false;
 	pid = pidSource;
 
 }
@@ -52,13 +57,6 @@ PCB::~PCB()
 
 }
 
-bool PCB::isInterrupted()
-{
-
-	return interrupted;
-
-}
-
 bool PCB::hasBeenInterrupted()
 {
 
@@ -124,7 +122,7 @@ int PCB::getHardDriveQuant()
 int PCB::getHardDrivesUsed()
 {
 
-	return hardDrivesUsed;
+	return devicesUsed[DEVICE_HARD_DRIVE];
 	
 }
 
@@ -146,7 +144,19 @@ int PCB::getProjectorQuant()
 int PCB::getProjectorsUsed()
 {
 
-	return projectorsUsed;
+	return devicesUsed[DEVICE_PROJECTOR];
+	
+}
+
+/**
+*	Function: getDevicesUsed()
+*	Description: returns the amount of requests this process made of the device with 
+*		the parameter DeviceId
+*/
+int PCB::getDevicesUsed(int device)
+{
+
+	return devicesUsed[device];
 	
 }
 
@@ -168,13 +178,6 @@ double PCB::getEstimatedProcessTime()
 
 }
 
-double PCB::getEstimatedTimeRemaining()
-{
-
-	return estimatedTimeRemaining;
-
-}
-
 /**
 *	Function: getProcessDuration
 *	Description: returns the duration of this process
@@ -186,25 +189,6 @@ double PCB::getProcessDuration()
 	
 }
 
-void PCB::interrupt()
-{
-
-	interrupted = true;
-	interruptHasOccurred = true;
-
-}
-
-void PCB::setInterrupt(bool source)
-{
-
-	interrupted = source;
-	if (source)
-	{
-		interruptHasOccurred = true;
-	}
-
-}
-
 void PCB::setInterruptOccurred(bool source)
 {
 	interruptHasOccurred = source;
@@ -268,7 +252,7 @@ void PCB::setHardDriveQuant(int source)
 void PCB::setHardDrivesUsed(int source)
 {
 
-	hardDrivesUsed = source;
+	devicesUsed[DEVICE_HARD_DRIVE] = source;
 	
 }
 
@@ -290,7 +274,7 @@ void PCB::setProjectorQuant(int source)
 void PCB::setProjectorsUsed(int source)
 {
 
-	projectorsUsed = source;
+	devicesUsed[DEVICE_PROJECTOR] = source;
 	
 }
 
@@ -323,13 +307,6 @@ void PCB::setEstimatedProcessTime(double source)
 
 }
 
-void PCB::setEstimatedTimeRemaining(double source)
-{
-
-	estimatedTimeRemaining = source;
-
-}
-
 /**
 *	Function: updateProcessDuration
 *	Description: updates the processDuration by adding the parameter duration to it
@@ -359,7 +336,7 @@ void PCB::incrementBlockCount()
 void PCB::incrementHardDrivesUsed()
 {
 
-	hardDrivesUsed++;
+	devicesUsed[DEVICE_HARD_DRIVE]++;
 
 }
 
@@ -370,7 +347,18 @@ void PCB::incrementHardDrivesUsed()
 void PCB::incrementProjectorsUsed()
 {
 
-	projectorsUsed++;
+	devicesUsed[DEVICE_PROJECTOR]++;
+
+}
+
+/**
+*	Function: incrementDevicesUsed()
+*	Description: adds 1 to the requests made of the device with the parameter DeviceId
+*/
+void PCB::incrementDevicesUsed(int device)
+{
+
+	devicesUsed[device]++;
 
 }
 
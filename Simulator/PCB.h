@@ -29,7 +29,6 @@ class PCB
 		PCB(int);
 		~PCB();
 		
-		bool isInterrupted();
 		bool hasBeenInterrupted();
 		int getpid();
 		int getBlockCount();
@@ -39,13 +38,11 @@ class PCB
 		int getHardDrivesUsed();
 		int getProjectorQuant();
 		int getProjectorsUsed();
+		int getDevicesUsed(int);
 		double getStartTime();
 		double getProcessDuration();
 		double getEstimatedProcessTime();
-		double getEstimatedTimeRemaining();
 		
-		void interrupt();
-		void setInterrupt(bool);
 		void setInterruptOccurred(bool);
 		void setpid(int);
 		void setBlockCount(int);
@@ -58,11 +55,11 @@ class PCB
 		void setStartTime(double);
 		void setProcessDuration(double);
 		void setEstimatedProcessTime(double);
-		void setEstimatedTimeRemaining(double);
 		void updateProcessDuration(double);
 		void incrementBlockCount();
 		void incrementHardDrivesUsed();
 		void incrementProjectorsUsed();
+		void incrementDevicesUsed(int);
 		
 		void saveState(double);
 		double loadState();
@@ -71,13 +68,14 @@ class PCB
 		
 	private:
 	
-		bool interrupted, interruptHasOccurred;
+		bool interruptHasOccurred; //the interrupt flag itself is kept by PcbTable
 	
 		int pid; //process ID
 		int blockCount, lastAddress, queueIndex;
-		int hardDriveQuant, hardDrivesUsed, projectorQuant, projectorsUsed;
+		int hardDriveQuant, projectorQuant;
+		int devicesUsed[DEVICE_COUNT]; //requests made of each device, see DeviceId
 		
-		double startTime, processDuration, estimatedProcessTime, estimatedTimeRemaining;
+		double startTime, processDuration, estimatedProcessTime;
 		double processData;
 
 };
@@ -0,0 +1,249 @@
+/**
+*	File Name: PcbTable.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class PcbTable. Holds the PCB of
+*		every process, keeps the fields the schedulers scan in arrays of their own,
+*		hands out pids that are reused once their process is removed and gives out
+*		handles that detect a removed process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "PcbTable.h"
+
+/**
+*	Function: PcbTable
+*	Description: Default constructor for PcbTable class, the table starts empty
+*/
+PcbTable::PcbTable()
+{
+
+}
+
+/**
+*	Function: ~PcbTable
+*	Description: Destructor for PcbTable class
+*/
+PcbTable::~PcbTable()
+{
+
+}
+
+/**
+*	Function: clear
+*	Description: Removes every process, the next process added gets slot 0 and pid 1
+*/
+void PcbTable::clear()
+{
+
+	records.clear();
+	remaining.clear();
+	interrupted.clear();
+	generations.clear();
+	used.clear();
+	pidSlots.clear();
+	freeSlots = priority_queue<int, vector<int>, greater<int> >();
+	freePids = priority_queue<int, vector<int>, greater<int> >();
+
+}
+
+/**
+*	Function: add
+*	Description: Stores pcb in the lowest free slot under the lowest free pid, which
+*		is set in the stored PCB, with time (msec) as its estimated time remaining and 
+*		its interrupt flag clear, and returns the handle of the new process. A table
+*		nothing was removed from gives process i slot i and pid i + 1.
+*/
+PcbHandle PcbTable::add(PCB pcb, double time)
+{
+
+	int slot = records.size();
+	if (!freeSlots.empty())
+	{
+		slot = freeSlots.top();
+		freeSlots.pop();
+	}
+	else
+	{
+		records.push_back(pcb);
+		remaining.push_back(0);
+		interrupted.push_back(0);
+		generations.push_back(0);
+		used.push_back(0);
+	}
+	
+	int pid = pidSlots.size() + 1;
+	if (!freePids.empty())
+	{
+		pid = freePids.top();
+		freePids.pop();
+		pidSlots[pid - 1] = slot;
+	}
+	else
+	{
+		pidSlots.push_back(slot);
+	}
+	
+	pcb.setpid(pid);
+	records[slot] = pcb;
+	remaining[slot] = time;
+	interrupted[slot] = 0;
+	used[slot] = 1;
+	
+	PcbHandle handle = {slot, generations[slot]};
+	return handle;
+
+}
+
+/**
+*	Function: remove
+*	Description: Frees the slot and the pid of the process with handle for the next
+*		processes added, every handle of the process becomes invalid. Returns false
+*		if handle was already invalid.
+*/
+bool PcbTable::remove(PcbHandle handle)
+{
+
+	if (!isValid(handle))
+	{
+		return 0;
+	}
+	
+	int pid = records[handle.slot].getpid();
+	pidSlots[pid - 1] = -1;
+	freePids.push(pid);
+	freeSlots.push(handle.slot);
+	used[handle.slot] = 0;
+	generations[handle.slot]++;
+	
+	return 1;
+
+}
+
+/**
+*	Function: isValid
+*	Description: returns true if handle refers to a process that was not removed
+*/
+bool PcbTable::isValid(PcbHandle handle)
+{
+
+	return handle.slot >= 0 && handle.slot < records.size() && used[handle.slot] &&
+		   generations[handle.slot] == handle.generation;
+
+}
+
+/**
+*	Function: size
+*	Description: returns the number of slots, including the slots of removed
+*		processes that were not reused yet
+*/
+int PcbTable::size()
+{
+
+	return records.size();
+
+}
+
+/**
+*	Function: slotOf
+*	Description: returns the slot of the process with pid, -1 if no process has it
+*/
+int PcbTable::slotOf(int pid)
+{
+
+	if (pid < 1 || pid > pidSlots.size())
+	{
+		return -1;
+	}
+	return pidSlots[pid - 1];
+
+}
+
+/**
+*	Function: operator[]
+*	Description: returns the PCB of the process in slot. Its estimated time remaining
+*		and interrupt flag are changed through the table, see setRemaining() and
+*		setInterrupt().
+*/
+PCB& PcbTable::operator[](int slot)
+{
+
+	return records[slot];
+
+}
+
+/**
+*	Function: getRemaining
+*	Description: returns the estimated time remaining (msec) of the process in slot
+*/
+double PcbTable::getRemaining(int slot)
+{
+
+	return remaining[slot];
+
+}
+
+/**
+*	Function: setRemaining
+*	Description: Sets the estimated time remaining of the process in slot to time
+*		(msec)
+*/
+void PcbTable::setRemaining(int slot, double time)
+{
+
+	remaining[slot] = time;
+
+}
+
+/**
+*	Function: getRemainingColumn
+*	Description: returns the estimated times remaining of every slot as one array,
+*		for schedulers that compare them all
+*/
+const double* PcbTable::getRemainingColumn()
+{
+
+	return remaining.data();
+
+}
+
+/**
+*	Function: isInterrupted
+*	Description: returns true if the process in slot is flagged to stop processing
+*/
+bool PcbTable::isInterrupted(int slot)
+{
+
+	return interrupted[slot];
+
+}
+
+/**
+*	Function: interrupt
+*	Description: Flags the process in slot to stop processing and records in its PCB 
+*		that it has been interrupted
+*/
+void PcbTable::interrupt(int slot)
+{
+
+	interrupted[slot] = 1;
+	records[slot].setInterruptOccurred(1);
+
+}
+
+/**
+*	Function: setInterrupt
+*	Description: Sets the interrupt flag of the process in slot to source, setting it 
+*		also records in its PCB that it has been interrupted
+*/
+void PcbTable::setInterrupt(int slot, bool source)
+{
+
+	interrupted[slot] = source;
+	if (source)
+	{
+		records[slot].setInterruptOccurred(1);
+	}
+
+}
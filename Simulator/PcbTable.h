@@ -0,0 +1,72 @@
+/**
+*	File Name: PcbTable.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class PcbTable. Holds the PCB of every
+*		process, keeps the fields the schedulers scan in arrays of their own, hands
+*		out pids that are reused once their process is removed and gives out handles
+*		that detect a removed process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef PCB_TABLE_
+#define PCB_TABLE_
+
+//library inclusion and directives
+
+#include <vector>
+#include <queue>
+#include <functional>
+#include "PCB.h"
+
+using namespace std;
+
+//refers to a process of a PcbTable, invalid once the process is removed
+struct PcbHandle
+{
+	int slot; //index of the process in the table
+	int generation; //processes the slot held before this one
+};
+
+class PcbTable
+{
+
+	//PcbTable class public declarations
+	public:
+	
+		PcbTable();
+		~PcbTable();
+	
+		void clear();
+		PcbHandle add(PCB, double);
+		bool remove(PcbHandle);
+		bool isValid(PcbHandle);
+		int size();
+		int slotOf(int);
+		PCB& operator[](int);
+	
+		double getRemaining(int);
+		void setRemaining(int, double);
+		const double* getRemainingColumn();
+		bool isInterrupted(int);
+		void interrupt(int);
+		void setInterrupt(int, bool);
+	
+	//PcbTable class private declarations
+	private:
+	
+		vector<PCB> records; //every other field of each process, indexed by slot
+	
+		//fields the schedulers read for every process, kept only here, indexed by slot
+		vector<double> remaining; //estimated time remaining (msec)
+		vector<char> interrupted;
+	
+		vector<int> generations;
+		vector<char> used; //1 if the slot holds a process
+		vector<int> pidSlots; //slot of each pid, -1 if the pid is free
+		priority_queue<int, vector<int>, greater<int> > freeSlots, freePids;
+	
+};
+
+#endif
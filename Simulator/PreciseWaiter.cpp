@@ -0,0 +1,172 @@
+/**
+*	File Name: PreciseWaiter.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class PreciseWaiter. Waits out the
+*		timers of the simulator by sleeping until shortly before the deadline and
+*		spinning for the rest, with the margin calibrated from how late the sleeps
+*		wake up, and measures how far past their deadlines the waits end
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "PreciseWaiter.h"
+#include <stdio.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include "Profiler.h"
+
+/**
+*	Function: PreciseWaiter
+*	Description: Default constructor for PreciseWaiter class, waits sleep before
+*		spinning
+*/
+PreciseWaiter::PreciseWaiter()
+{
+
+	pthread_mutex_init(&mutexWaiter, NULL);
+	reset(Config());
+
+}
+
+/**
+*	Function: ~PreciseWaiter
+*	Description: Destructor for PreciseWaiter class
+*/
+PreciseWaiter::~PreciseWaiter()
+{
+
+	pthread_mutex_destroy(&mutexWaiter);
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every measurement and the calibrated margin. Whether waits
+*		sleep or only spin is taken from configData.
+*/
+void PreciseWaiter::reset(Config configData)
+{
+
+	pthread_mutex_lock(&mutexWaiter);
+	mode = configData.getTimerWaitMode();
+	margin = INITIAL_MARGIN;
+	waits = 0;
+	sleeps = 0;
+	waitedTime = 0;
+	spunTime = 0;
+	totalLateness = 0;
+	maxLateness = 0;
+	squaredLateness = 0;
+	pthread_mutex_unlock(&mutexWaiter);
+
+}
+
+/**
+*	Function: wait
+*	Description: Returns once nanoseconds have passed on the monotonic clock. Sleeps
+*		until the margin before the deadline, so the wait takes next to no processor
+*		time, then spins for the rest, since a sleep can wake up late but a spin ends
+*		right at the deadline. Waits shorter than the margin only spin. Any number of
+*		threads may wait at once.
+*/
+void PreciseWaiter::wait(long long nanoseconds)
+{
+
+	long long start = Profiler::now();
+	long long deadline = start + nanoseconds;
+	
+	pthread_mutex_lock(&mutexWaiter);
+	long long wake = mode == TIMER_HYBRID ? deadline - margin : start;
+	pthread_mutex_unlock(&mutexWaiter);
+	
+	bool slept = wake > start;
+	if (slept)
+	{
+		struct timespec until = {(time_t) (wake / 1000000000),
+								 (long) (wake % 1000000000)};
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) == EINTR)
+		{
+		}
+	}
+	long long spinStart = Profiler::now();
+	while (Profiler::now() < deadline)
+	{
+	}
+	long long end = Profiler::now();
+	
+	pthread_mutex_lock(&mutexWaiter);
+	if (slept)
+	{
+		sleeps++;
+		calibrate(spinStart - wake);
+	}
+	waits++;
+	waitedTime += end - start;
+	spunTime += end - spinStart;
+	totalLateness += end - deadline;
+	maxLateness = max(maxLateness, end - deadline);
+	squaredLateness += pow((end - deadline) / 1000.0, 2);
+	pthread_mutex_unlock(&mutexWaiter);
+
+}
+
+/**
+*	Function: print
+*	Description: Writes how many waits there were, how late they ended on average,
+*		their jitter (the standard deviation of the lateness) and the longest, all in
+*		microseconds of real time whatever the time scale, and what share of the
+*		waiting was spent spinning. Writes nothing if nothing waited.
+*/
+void PreciseWaiter::print(ostream& out)
+{
+
+	char line[160];
+	
+	pthread_mutex_lock(&mutexWaiter);
+	if (waits == 0)
+	{
+		pthread_mutex_unlock(&mutexWaiter);
+		return;
+	}
+	
+	double meanLateness = totalLateness / 1000.0 / waits;
+	double jitter = sqrt(max(squaredLateness / waits - meanLateness * meanLateness,
+							 0.0));
+	out << endl << "Timer Waits (" << (mode == TIMER_HYBRID ? "hybrid" : "spin")
+		<< ", microseconds of real time, sleep margin " << margin / 1000.0 << ")" 
+		<< endl;
+	snprintf(line, sizeof(line), "%7s %7s %10s %9s %9s %9s\n", "waits", "slept",
+			 "mean late", "jitter", "max late", "spinning");
+	out << line;
+	snprintf(line, sizeof(line), "%7ld %7ld %10.2f %9.2f %9.2f %8.1f%%\n", waits,
+			 sleeps, meanLateness, jitter, maxLateness / 1000.0,
+			 waitedTime > 0 ? 100.0 * spunTime / waitedTime : 0.0);
+	out << line;
+	pthread_mutex_unlock(&mutexWaiter);
+
+}
+
+/**
+*	Function: calibrate
+*	Description: Adjusts the margin to a sleep that woke up overshoot nanoseconds
+*		after it was asked to. The margin covers the overshoot with a quarter to
+*		spare; a late wake-up raises it at once, while an early one only lets it
+*		shrink slowly, so one quick wake-up does not make the next waits late.
+*/
+void PreciseWaiter::calibrate(long long overshoot)
+{
+
+	long long target = overshoot + overshoot / 4 + MIN_MARGIN;
+	if (target > margin)
+	{
+		margin = target < MAX_MARGIN ? target : MAX_MARGIN;
+	}
+	else
+	{
+		margin -= (margin - target) / 16;
+	}
+
+}
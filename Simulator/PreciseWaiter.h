@@ -0,0 +1,60 @@
+/**
+*	File Name: PreciseWaiter.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class PreciseWaiter. Waits out the timers of
+*		the simulator by sleeping until shortly before the deadline and spinning for
+*		the rest, with the margin calibrated from how late the sleeps wake up, and
+*		measures how far past their deadlines the waits end
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef PRECISE_WAITER_
+#define PRECISE_WAITER_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <pthread.h>
+#include "Config.h"
+
+using namespace std;
+
+class PreciseWaiter
+{
+
+	//PreciseWaiter class public declarations
+	public:
+	
+		PreciseWaiter();
+		~PreciseWaiter();
+	
+		void reset(Config);
+		void wait(long long);
+		void print(ostream&);
+	
+		//nanoseconds the sleep ends before the deadline, the margin starts at
+		//INITIAL_MARGIN and is calibrated between MIN_MARGIN and MAX_MARGIN
+		static const long long INITIAL_MARGIN = 100000;
+		static const long long MIN_MARGIN = 10000;
+		static const long long MAX_MARGIN = 2000000;
+	
+	//PreciseWaiter class private declarations
+	private:
+	
+		void calibrate(long long);
+	
+		int mode; //TimerWaitMode
+		long long margin;
+	
+		//nanoseconds, lateness is how long after its deadline a wait ended
+		long waits, sleeps;
+		long long waitedTime, spunTime, totalLateness, maxLateness;
+		double squaredLateness; //microseconds squared, for the jitter
+	
+		pthread_mutex_t mutexWaiter;
+	
+};
+
+#endif
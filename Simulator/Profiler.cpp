@@ -0,0 +1,250 @@
+/**
+*	File Name: Profiler.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the classes Profiler and ProfileScope.
+*		Measures how much real time the simulator spends in its own machinery
+*		(preparing, loading, scheduling, logging, creating threads) compared to the
+*		simulated work
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Profiler.h"
+#include <stdio.h>
+#include <time.h>
+
+thread_local ProfileScope* ProfileScope::current = NULL;
+
+/**
+*	Function: Profiler
+*	Description: Default constructor for Profiler class
+*/
+Profiler::Profiler()
+{
+
+	timeScale = 1;
+	reset();
+
+}
+
+/**
+*	Function: reset
+*	Description: Forgets every measurement. Must not be called while a scope is open.
+*/
+void Profiler::reset()
+{
+
+	for (int i = 0; i < PROFILE_SECTION_COUNT; i++)
+	{
+		totalTimes[i].store(0);
+		exclusiveTimes[i].store(0);
+		maxTimes[i].store(0);
+		calls[i].store(0);
+		plannedTimes[i].store(0);
+	}
+
+}
+
+/**
+*	Function: add
+*	Description: Records one call of section that took total nanoseconds, exclusive of
+*		which were not spent in other measured sections
+*/
+void Profiler::add(int section, long long total, long long exclusive)
+{
+
+	totalTimes[section].fetch_add(total, memory_order_relaxed);
+	exclusiveTimes[section].fetch_add(exclusive, memory_order_relaxed);
+	calls[section].fetch_add(1, memory_order_relaxed);
+	
+	//a failed exchange reloads longest, so this stops once total is not a new maximum
+	long long longest = maxTimes[section].load(memory_order_relaxed);
+	while (total > longest &&
+		   !maxTimes[section].compare_exchange_weak(longest, total, memory_order_relaxed))
+	{
+	}
+
+}
+
+/**
+*	Function: addPlanned
+*	Description: Records that section was asked to do milliseconds of simulated work
+*/
+void Profiler::addPlanned(int section, long milliseconds)
+{
+
+	plannedTimes[section].fetch_add(milliseconds, memory_order_relaxed);
+
+}
+
+/**
+*	Function: setTimeScale
+*	Description: sets the real time the simulated work takes per unit of simulated
+*		time to source, so planned work is compared with the real time it took
+*/
+void Profiler::setTimeScale(double source)
+{
+
+	timeScale = source;
+
+}
+
+/**
+*	Function: print
+*	Description: Writes the calls, total, exclusive, mean and maximum real time of each
+*		section to out, followed by how much of the run programDuration (in simulated
+*		seconds) went to the simulator's own machinery rather than to simulated work
+*/
+void Profiler::print(ostream& out, double programDuration)
+{
+
+	char line[160];
+	double machinery = 0, overhead = 0;
+	
+	out << endl << "Simulator Profile (milliseconds of real time)" << endl;
+	snprintf(line, sizeof(line), "%-15s %7s %10s %10s %9s %9s %10s %10s\n", "section",
+			 "calls", "total", "exclusive", "mean", "max", "planned", "overhead");
+	out << line;
+	for (int i = 0; i < PROFILE_SECTION_COUNT; i++)
+	{
+		unsigned long long count = calls[i].load();
+		if (count == 0)
+		{
+			continue;
+		}
+	
+		double total = totalTimes[i].load() / 1000000.0;
+		double exclusive = exclusiveTimes[i].load() / 1000000.0;
+		snprintf(line, sizeof(line), "%-15s %7llu %10.3f %10.3f %9.3f %9.3f",
+				 getSectionName(i), count, total, exclusive, total / count,
+				 maxTimes[i].load() / 1000000.0);
+		out << line;
+	
+		//sections that run simulated work are only charged for the time past it
+		if (i == PROFILE_HANDLE_PROCESS || i == PROFILE_DEVICE)
+		{
+			double planned = plannedTimes[i].load() * timeScale;
+			snprintf(line, sizeof(line), " %10.3f %10.3f", planned, exclusive - planned);
+			out << line;
+			overhead += exclusive - planned;
+		}
+		else if (isMachinery(i))
+		{
+			machinery += exclusive;
+		}
+		out << endl;
+	}
+	
+	double run = programDuration * timeScale * 1000;
+	snprintf(line, sizeof(line), "simulator machinery: %.3f ms, handler overhead: "
+			 "%.3f ms, %.1f%% of the %.3f ms run\n", machinery, overhead,
+			 run > 0 ? 100 * (machinery + overhead) / run : 0.0, run);
+	out << line;
+	snprintf(line, sizeof(line), "log writer thread: %.3f ms (runs alongside the "
+			 "simulation)\n", exclusiveTimes[PROFILE_LOG_WRITER].load() / 1000000.0);
+	out << line << endl;
+
+}
+
+/**
+*	Function: now
+*	Description: returns the current time of the monotonic clock in nanoseconds
+*/
+long long Profiler::now()
+{
+
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1000000000LL + time.tv_nsec;
+
+}
+
+/**
+*	Function: getSectionName
+*	Description: returns the name of the profiled section
+*/
+const char* Profiler::getSectionName(int section)
+{
+
+	switch (section)
+	{
+		case PROFILE_PREP_PROGRAM:
+			return "prepProgram";
+		case PROFILE_LOAD_PROGRAM:
+			return "loadProgram";
+		case PROFILE_SCHEDULING:
+			return "scheduling";
+		case PROFILE_HANDLE_PROCESS:
+			return "handleProcess";
+		case PROFILE_DEVICE:
+			return "device threads";
+		case PROFILE_LOGGING:
+			return "logging";
+		case PROFILE_LOG_WRITER:
+			return "log writer";
+		case PROFILE_THREAD_CREATE:
+			return "thread creation";
+		default:
+			return "unknown";
+	}
+
+}
+
+/**
+*	Function: isMachinery
+*	Description: returns true if section is part of the simulator's own machinery on
+*		the simulating threads (everything but the simulated work and the log writer)
+*/
+bool Profiler::isMachinery(int section)
+{
+
+	return section == PROFILE_PREP_PROGRAM || section == PROFILE_LOAD_PROGRAM ||
+		   section == PROFILE_SCHEDULING || section == PROFILE_LOGGING ||
+		   section == PROFILE_THREAD_CREATE;
+
+}
+
+/**
+*	Function: ProfileScope
+*	Description: Parameterized constructor for ProfileScope class. Starts measuring
+*		section for profilerSource until the scope is destroyed. Nothing is measured
+*		if profilerSource is NULL.
+*/
+ProfileScope::ProfileScope(Profiler* profilerSource, int sectionSource)
+{
+
+	profiler = profilerSource;
+	section = sectionSource;
+	childTime = 0;
+	parent = NULL;
+	start = 0;
+	if (profiler != NULL)
+	{
+		parent = current;
+		current = this;
+		start = Profiler::now();
+	}
+
+}
+
+/**
+*	Function: ~ProfileScope
+*	Description: Destructor for ProfileScope class. Records the time since the scope
+*		was created and charges it to the scope this one is nested in as child time.
+*/
+ProfileScope::~ProfileScope()
+{
+
+	if (profiler != NULL)
+	{
+		long long elapsed = Profiler::now() - start;
+		profiler->add(section, elapsed, elapsed - childTime);
+		if (parent != NULL)
+		{
+			parent->childTime += elapsed;
+		}
+		current = parent;
+	}
+
+}
@@ -0,0 +1,88 @@
+/**
+*	File Name: Profiler.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the classes Profiler and ProfileScope. Measures
+*		how much real time the simulator spends in its own machinery (preparing,
+*		loading, scheduling, logging, creating threads) compared to the simulated work
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef PROFILER_
+#define PROFILER_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <atomic>
+
+using namespace std;
+
+//parts of the simulator that are measured
+enum ProfileSection
+{
+	PROFILE_PREP_PROGRAM, PROFILE_LOAD_PROGRAM, PROFILE_SCHEDULING,
+	PROFILE_HANDLE_PROCESS, PROFILE_DEVICE, PROFILE_LOGGING, PROFILE_LOG_WRITER,
+	PROFILE_THREAD_CREATE, PROFILE_SECTION_COUNT
+};
+
+class Profiler
+{
+
+	//Profiler class public declarations
+	public:
+	
+		Profiler();
+	
+		void reset();
+		void add(int, long long, long long);
+		void addPlanned(int, long);
+		void setTimeScale(double);
+		void print(ostream&, double);
+	
+		static long long now();
+		static const char* getSectionName(int);
+	
+	//Profiler class private declarations
+	private:
+	
+		bool isMachinery(int);
+	
+		//nanoseconds, exclusive time leaves out the time of scopes nested inside
+		atomic<long long> totalTimes[PROFILE_SECTION_COUNT];
+		atomic<long long> exclusiveTimes[PROFILE_SECTION_COUNT];
+		atomic<long long> maxTimes[PROFILE_SECTION_COUNT];
+		atomic<unsigned long long> calls[PROFILE_SECTION_COUNT];
+	
+		//milliseconds of simulated work the section was asked to do
+		atomic<long long> plannedTimes[PROFILE_SECTION_COUNT];
+		double timeScale; //real milliseconds per simulated millisecond
+	
+};
+
+class ProfileScope
+{
+
+	//ProfileScope class public declarations
+	public:
+	
+		ProfileScope(Profiler*, int);
+		~ProfileScope();
+	
+	//ProfileScope class private declarations
+	private:
+	
+		ProfileScope(const ProfileScope&);
+		ProfileScope& operator=(const ProfileScope&);
+	
+		Profiler* profiler; //NULL if nothing is measured
+		int section;
+		long long start, childTime;
+		ProfileScope* parent; //scope this one is nested in on the same thread
+	
+		static thread_local ProfileScope* current;
+	
+};
+
+#endif
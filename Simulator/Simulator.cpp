@@ -0,0 +1,2626 @@
+/**
+*	File Name: Simulator.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Implementation file for the class Simulator. Owns all of the state 
+*		of a single simulation (program queues, PCBs, memory and device locks) so that 
+*		several simulations can run side by side in one process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#include "Simulator.h"
+
+/**
+*	Function: Simulator
+*	Description: Parameterized constructor for Simulator class with parameter 
+*		configSource used as the configuration of the simulation
+*/
+Simulator::Simulator(Config configSource)
+{
+
+	configData = configSource;
+	outputType = configData.getLogType();
+	scheduleType = configData.getCpuScheduleCode();
+	quantumNumber = configData.getProcessorQuantumNumber();
+	programDuration = 0;
+	blockCount = 0;
+	lastAddress = 0;
+	prevFrontIndex = 0;
+	activeProcesses = 0;
+	ableToReorder = true;
+	interruptOccurred = false;
+	instructionsPreset = false;
+	programStart = 0;
+	timeScale = configData.getTimeScale();
+	pthread_mutex_init(&mutexQueues, NULL);
+	logger.addSink(&metrics);
+	logger.setProfiler(&profiler);
+	dispatcher.setDecisionLog(&decisions);
+
+}
+
+/**
+*	Function: ~Simulator
+*	Description: Destructor for Simulator class
+*/
+Simulator::~Simulator()
+{
+
+	logger.stop();
+	if (fout.is_open())
+	{
+		fout.close();
+	}
+	pthread_mutex_destroy(&mutexQueues);
+
+}
+
+/**
+*	Function: run
+*	Description: Runs a complete simulation for the configuration this simulator was 
+*		constructed with. Reads and outputs the meta-data file specified in configData, 
+*		prepares the program and then runs it. The results of the run are recorded in 
+*		summary. Returns 1 if no errors occurred, and -1 if an error did occur.
+*/
+int Simulator::run(SimulationSummary& summary)
+{
+
+	ifstream fin;
+	string metaDataFile; //used to store the filename of the meta data file
+	bool okToContinue; //used to stop the program if error ocurred
+	//double-ended queue of the ADT MetaData - used to store data from an instruction
+	//in the Meta Data file
+	deque<MetaData> instructionSet;
+	clock_t start = clockTicks();
+	
+	summary.ok = false;
+	summary.scheduleType = configData.getCpuScheduleName();
+	summary.processCount = 0;
+	summary.instructionCount = 0;
+	summary.estimatedTime = 0;
+	summary.simulatedTime = 0;
+	summary.elapsedTime = 0;
+	
+	scheduleType = configData.getCpuScheduleCode();
+	quantumNumber = configData.getProcessorQuantumNumber();
+	
+	//assigning metaDataFile to file name specified in config data
+	metaDataFile = configData.getFilePath();
+	
+	//resetting memory and any state left over from a previous program
+	blockCount = 0;
+	lastAddress = 0;
+	activeProcesses = 0;
+	programDuration = 0;
+	program.clear();
+	waitingQueue.clear();
+	readyQueue.clear();
+	waitingProcessIndeces.clear();
+	loadedProcessIndeces.clear();
+	pcbContainer.clear();
+	profiler.reset();
+	timeScale = configData.getTimeScale();
+	profiler.setTimeScale(timeScale);
+	
+	if (instructionsPreset)
+	{
+		//the program was parsed ahead of time, only the total times have to be 
+		//recalculated for this configuration
+		instructionSet = presetInstructions;
+		calculateTotalTimes(instructionSet);
+		okToContinue = true;
+	}
+	else
+	{
+		//begin meta-data file error checking and input
+		fin.open(metaDataFile);
+		if (!fin.is_open())
+		{
+			//file does not exist
+			cout << "ERROR: Meta-Data file specified in config file does not exist" << 
+			endl;
+			return -1;
+		}
+		else
+		{
+			//storing meta data file to instructionSet - a double-ended queue of 
+			//Meta-Data
+			//okToContinue is true if no errors occur during the data retrieval 
+			//process
+			okToContinue = getMetaData(fin, instructionSet);
+		}
+		fin.close();
+	}
+	
+	//begin output
+	if (okToContinue)
+	{
+		output(instructionSet);
+	}
+	else
+	{
+		//cout << "ERROR: Meta-Data could not be stored" << endl;
+		return -1;
+	}
+	
+	if (!checkTimeScale(instructionSet))
+	{
+		return -1;
+	}
+	
+	if (okToContinue)
+	{
+		okToContinue = prepProgram(instructionSet);
+	}
+	else
+	{
+		return -1;
+	}
+	
+	if (okToContinue)
+	{
+		outputType = configData.getLogType();
+		if (!configData.getAnalyticFastPath() || !runAnalytic(instructionSet))
+		{
+			okToContinue = runProgram();
+		}
+	}
+	else
+	{
+		cout << "ERROR: Program " << summary.configPath << " could not be instantiated" 
+			 << endl;
+		return -1;
+	}
+	
+	//a failed run can leave events behind, they are written before the file closes
+	logger.stop();
+	fout.close();
+	
+	summary.ok = okToContinue;
+	summary.processCount = pcbContainer.size();
+	summary.instructionCount = instructionSet.size();
+	for (int i = 0; i < pcbContainer.size(); i++)
+	{
+		summary.estimatedTime += pcbContainer[i].getEstimatedProcessTime();
+	}
+	summary.simulatedTime = programDuration;
+	summary.elapsedTime = (clockTicks() - start) / (double) CLOCKS_PER_SEC;
+	
+	//deallocting memory
+	blockCount = 0;
+	lastAddress = 0;
+	
+	return 1;
+
+}
+/**
+*	Function: setInstructionSet
+*	Description: Gives the simulator a program that has already been read from a 
+*		meta-data file. run() then uses this program instead of reading the file named 
+*		in the configuration and only recalculates the total time of each instruction.
+*/
+void Simulator::setInstructionSet(deque<MetaData> instructionSet)
+{
+
+	presetInstructions = instructionSet;
+	instructionsPreset = true;
+
+}
+
+/**
+*	Function: getMetaData
+*	Description: Gets input from the specified meta-data file (specified in 
+*		configuration file) and stores the instructions that are contained in the file 
+*		to individual objects of the class MetaData. These objects are pushed onto the 
+*		instructionSet - a double ended queue. configData is needed as a parameter to 
+*		calculate the correct total time of the component. Returns true if no errors 
+*		occurred and false if an error did occur.
+*/
+bool Simulator::getMetaData(ifstream& fin, deque<MetaData>& instructionSet)
+{
+
+	string line, instruction;
+	
+	//checking starting line
+	getline(fin, line);
+	if (line != "Start Program Meta-Data Code:")
+	{
+		cout << "ERROR: Typo in meta data file" << endl;
+		return 0;
+	}
+	line.clear();
+	
+	//begin meta-data extraction process
+	fin >> instruction;
+	//this loop stops once the last character in the input string is not a semi-colon
+	while (instruction[instruction.length() - 1] == ';')
+	{
+		MetaData currentData; //temporary storage, will be stored in instructionSet 
+							  //once all errors are checked
+		if (!currentData.parseMetaData(instruction))
+		{
+			//error occurred while parsing meta-data
+			//cout << "ERROR: Error in meta-data" << endl;
+			return 0;
+		}
+		instructionSet.push_back(currentData); //adding instruction to the set
+		instruction.clear();
+		fin >> instruction;
+		if (instruction.substr(2, 4) == "hard")
+		{
+			//checking if descriptor is case "hard drive" which would stop the loop if 
+			//not accounted for		
+			string restOfInstruction;
+			fin >> restOfInstruction;
+			//continuing instruction by appending the space and the rest of the 
+			//instruction
+			instruction.append(" ");
+			instruction.append(restOfInstruction);
+		}
+	}
+	//once loop stops, there should be one more meta-data instruction to extract
+	if (instruction[instruction.length() - 1] == '.')
+	{
+		MetaData currentData;
+		if (!currentData.parseMetaData(instruction))
+		{
+			cout << "ERROR: Error in meta data" << endl;
+			return 0;
+		}
+		instructionSet.push_back(currentData);
+		instruction.clear();
+	}
+	else
+	{
+		cout << "ERROR: No '.' found to end meta data scanning" << endl;
+		return 0;
+	}
+	
+	//checking ending line
+	getline(fin, line);
+	getline(fin, line);
+	if (line != "End Program Meta-Data Code.")
+	{
+		cout << "ERROR: Typo in meta data file" << endl;
+		return 0;
+	}
+	line.clear();
+	
+	//all instructions are stored, calculating their total times at once
+	calculateTotalTimes(instructionSet);
+	
+	return 1;
+
+}
+
+/**
+*	Function: calculateTotalTimes
+*	Description: Calculates the total time of every instruction in instructionSet for 
+*		the configuration of this simulator in one pass over the whole set, instead of 
+*		looking up the device time of each instruction separately
+*/
+void Simulator::calculateTotalTimes(deque<MetaData>& instructionSet)
+{
+
+	InstructionArrays arrays;
+	int deviceTimes[DEVICE_COUNT];
+	
+	configData.getDeviceTimeTable(deviceTimes);
+	MetaData::buildArrays(instructionSet, arrays);
+	MetaData::calculateTotalTimes(deviceTimes, arrays);
+	for (int i = 0; i < instructionSet.size(); i++)
+	{
+		instructionSet[i].setTotalTime(arrays.totalTimes[i]);
+	}
+
+}
+
+bool Simulator::prepProgram(deque<MetaData> instructionSet)
+{
+
+	ProfileScope scope(&profiler, PROFILE_PREP_PROGRAM);
+	
+	vector<int> processIndeces, processTimes;
+	InstructionArrays arrays;
+	int processCount = 0;
+	
+	//estimated time of each process
+	MetaData::buildArrays(instructionSet, arrays);
+	MetaData::sumProcessTimes(arrays, processTimes);
+	
+	//determine the indeces of the beginning of each process 
+	//and the amount of processes
+	for (int i = 0; i < instructionSet.size(); i++)
+	{
+		if (instructionSet[i].getCode() == 'A' && 
+			instructionSet[i].getDescriptor() == "begin")
+		{
+			processIndeces.push_back(i);
+			processCount++;
+		}
+	}
+	
+	//use indeces to separate processes into individual deques
+	deque<MetaData> processes[processCount];
+	for (int i = 0; i < processCount; i++)
+	{
+		if (i == processCount - 1)
+		{
+			for (int j = processIndeces[i]; j < instructionSet.size(); j++)
+			{
+				if (instructionSet[j].getCode() != 'S' && 
+					instructionSet[j].getCode() != 'A')
+				{
+					processes[i].push_back(instructionSet[j]);
+				}
+			}
+		}
+		else
+		{
+			for (int j = processIndeces[i]; j < processIndeces[i + 1] + 1; j++)
+			{
+				if (instructionSet[j].getCode() != 'S' && 
+					instructionSet[j].getCode() != 'A')
+				{
+					processes[i].push_back(instructionSet[j]);
+				}
+			}
+		}
+		
+		program.push_back(processes[i]);
+	}
+	
+	//to ensure consistency, adding meta data start and finish commands for 
+	//application to the queues
+	MetaData systemBegin, systemFinish, appBegin, appFinish;
+	systemBegin.setData('S', "begin", 0, 0);
+	systemFinish.setData('S', "finish", 0, 0);
+	appBegin.setData('A', "begin", 0, 0);
+	appFinish.setData('A', "finish", 0, 0);
+	for (int i = 0; i < program.size(); i++)
+	{
+		program[i].push_front(appBegin);
+		program[i].push_back(appFinish);
+	}
+	
+	//construct pcb data for each process, process i gets slot i and pid i + 1
+	PCB pcb;
+	pcb.setHardDriveQuant(configData.getHddQuant());
+	pcb.setProjectorQuant(configData.getProjQuant());
+	pcb.setStartTime(0);
+	pcb.setProcessDuration(0);
+	for (int i = 0; i < program.size(); i++)
+	{
+		pcb.setEstimatedProcessTime(processTimes[i]);
+		pcbContainer.add(pcb, processTimes[i]);
+	}
+	
+	if (configData.getCpuScheduleCode() == 1)
+	{
+		//PS
+		deque<deque<MetaData>> processStorage = program;
+		prioritySchedule(processStorage);
+	}
+	else if (configData.getCpuScheduleCode() == 2)
+	{
+		//SJF
+		deque<deque<MetaData>> processStorage = program;
+		shortestJobFirstSchedule(processStorage);
+	}
+	else
+	{
+		//FIFO or preemptive scheduling algorithm
+		for (int i = 0; i < program.size(); i++)
+		{
+			waitingProcessIndeces.push_back(i);
+		}
+	}
+	
+	program[0].push_front(systemBegin);
+	//program[program.size() - 1].push_back(systemFinish);
+	
+	waitingQueue = program;
+	
+	return true;
+	
+
+}
+
+bool Simulator::loadProgram()
+{
+
+	ProfileScope scope(&profiler, PROFILE_LOAD_PROGRAM);
+	
+	pthread_mutex_lock(&mutexQueues);
+	logger.log(simulationTime(), EVENT_PROCESS_ARRIVE, waitingProcessIndeces[0] + 1);
+	
+	if (scheduleType == 3)
+	{
+	
+		if (readyQueue.empty())
+		{
+			readyQueue.push_back(waitingQueue[0]);
+			loadedProcessIndeces.push_back(waitingProcessIndeces[0]);
+			waitingQueue.pop_front();
+			waitingProcessIndeces.pop_front();
+			//cout << "arrival of process " << loadedProcessIndeces.back() + 1 << endl;
+			pcbContainer[loadedProcessIndeces[0]].setQueueIndex(0);
+		}
+		else
+		{
+			readyQueue.push_back(waitingQueue[0]);
+			loadedProcessIndeces.push_back(waitingProcessIndeces[0]);
+			waitingQueue.pop_front();
+			waitingProcessIndeces.pop_front();
+			//cout << "arrival of process " << loadedProcessIndeces.back() + 1 << endl;
+			if (ableToReorder)
+			{
+				shortestTimeRemainingSchedule(readyQueue, loadedProcessIndeces);
+			}
+		}
+		
+	}
+	else
+	{
+	
+		readyQueue.push_back(waitingQueue[0]);
+		loadedProcessIndeces.push_back(waitingProcessIndeces[0]);
+		waitingQueue.pop_front();
+		waitingProcessIndeces.pop_front();
+		
+	}
+	pthread_mutex_unlock(&mutexQueues);
+	
+	return true;
+
+}
+
+/**
+*	Function: runProgram
+*	Description: Runs a set of Meta Data insturctions called a program. Keeps track of 
+*		the time the program takes to run. Begins and ends the logging process of 
+*		actions taken by the program and processes inside the program. Takes parameters 
+*		configData, program, and programNum to know the configuration of the devices 
+*		the program uses as well as the instructions of the program and the number of 
+*		the program.
+*/
+bool Simulator::runProgram()
+{
+
+	//PCB processData[program.size()];
+	clock_t start;
+	double duration;
+	int rc;
+	bool okToContinue = 1;
+	struct timespec idle = {0, 1000000};
+	
+	//setting parameters of program's process control blocks
+	/*for (int i = 0; i < program.size(); i++)
+	{
+		processData[i].setpid(i + 1);
+		processData[i].setHardDriveQuant(configData.getHddQuant());
+		processData[i].setProjectorQuant(configData.getProjQuant());
+		processData[i].setStartTime(0);
+		processData[i].setProcessDuration(0);
+	}*/
+	
+	
+	//a seed from the clock is picked once, so every part of the run uses the same one
+	if (configData.getRandomSeed() == 0)
+	{
+		configData.setRandomSeed(time(NULL));
+	}
+	
+	//starting the background thread that writes the log, the metrics follow it
+	metrics.reset(pcbContainer.size());
+	deviceStats.reset(configData);
+	latencies.reset();
+	diskModel.reset(configData, configData.getHddQuant());
+	dispatcher.reset(configData);
+	bufferCache.reset(configData);
+	interrupts.reset(configData);
+	waiter.reset(configData);
+	
+	//a replayed run takes the seed of the run it replays
+	decisions.reset(configData.getDecisionLogMode());
+	decisions.setSeed(configData.getRandomSeed());
+	if (configData.getDecisionLogMode() == DECISIONS_REPLAY)
+	{
+		ifstream decisionFile(configData.getDecisionLogPath().c_str());
+		if (!decisionFile.is_open() || !decisions.load(decisionFile))
+		{
+			cout << "ERROR: Decision log " << configData.getDecisionLogPath()
+				 << " could not be read" << endl;
+			return 0;
+		}
+	}
+	random.seed(decisions.getSeed());
+	
+	if (!logger.start(outputType, &cout, &fout))
+	{
+		return 0;
+	}
+	
+	//starting program clock and initializing duration
+	start = simulatedTicks();
+	programStart = start;
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	
+	//sampling device telemetry while the program runs, if asked for
+	samplingDone.store(false);
+	workerThreads.clear();
+	if (configData.getDeviceSampleInterval() > 0)
+	{
+		rc = createThread(&sampleThread, &samplerThread, this);
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+	}
+	
+	//loops through each meta data instruction and calls handleProcess() to handle 
+	//each task
+	/*for (int i = 0; i < program.size(); i++)
+	{
+		for (int j = 0; j < program[i].size(); j++)
+		{
+			if (okToContinue)
+			{
+				duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+				pcbContainer[i].setProcessDuration(duration);
+				okToContinue = handleProcess(program[i][j], 
+											 pcbContainer[i]);
+			}
+			else
+			{
+				return 0;
+			}
+			duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+		}
+	}*/
+	
+	rc = createThread(&loadThread, &loaderThread, this);
+	if (rc)
+	{
+		cout << "ERROR: return code from pthread_create() is " << rc << endl;
+		exit(-1);
+	}
+	
+	if (scheduleType == 4)
+	{
+		roundRobinDone.store(false);
+		rc = createThread(&rrThread, &rrHandlerThread, this);
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+	}
+	
+	//the queues are only left unlocked while an instruction runs (see handleQueued()) 
+	//or while the run waits for the loader
+	pthread_mutex_lock(&mutexQueues);
+	int processIndex = 0;
+	int dispatchedIndex = -1;
+	//the loader may move the last processes to the ready queue at any time, so the
+	//program only ends once both queues are empty
+	while (!waitingQueue.empty() || !readyQueue.empty())
+	{
+		if (readyQueue.empty())
+		{
+			//sleeps until the loader moves the next process to the ready queue
+			pthread_mutex_unlock(&mutexQueues);
+			nanosleep(&idle, NULL);
+			pthread_mutex_lock(&mutexQueues);
+		}
+		while (!readyQueue.empty())
+		{
+			okToContinue = 1;		
+			processIndex = loadedProcessIndeces[0];	
+			//cout << processIndex + 1 << endl;
+			//cout << queueIndex << endl;
+			deque<MetaData> currentProcess = readyQueue[0];
+			
+			while (!readyQueue[0].empty() && okToContinue)
+			{
+				//readyQueue[0][0].print();
+				//cout << endl;
+				
+				//ableToReorder = true;
+				//while (reordering) {};
+				//ableToReorder = false;
+				processIndex = loadedProcessIndeces[0];
+				//cout << queueIndex << endl;
+				if (processIndex != dispatchedIndex)
+				{
+					decisions.record(DECISION_DISPATCH, 0, DEVICE_PROCESSOR,
+									 processIndex + 1);
+					dispatchedIndex = processIndex;
+				}
+				if (okToContinue)
+				{
+					//ableToReorder = true;
+					interruptOccurred = false;
+					duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+					pcbContainer[processIndex].setProcessDuration(duration);
+					okToContinue = handleQueued(readyQueue[0][0], 
+												pcbContainer[processIndex]);
+					
+					if (okToContinue)
+					{
+						//ableToReorder = true;						 	 
+						//while (reordering) {};
+						//ableToReorder = false;
+						//currentProcess.pop_front();
+						//processIndex = loadedProcessIndeces[0];	
+						//the process may have moved in the ready queue while its 
+						//instruction ran, so currentProcess can run out first
+						if (interruptOccurred && !currentProcess.empty() && 
+							currentProcess[0].getCode() != 'P')
+						{
+							if (hasInstruction(prevFrontIndex))
+							{
+								readyQueue[prevFrontIndex].pop_front();
+							}
+							currentProcess.pop_front();
+							ableToReorder = false;
+							while (hasInstruction(prevFrontIndex) && 
+								   !currentProcess.empty() && 
+								   currentProcess[0].getCode() != 'P')
+							{
+								duration = ((simulatedTicks() - start) / 
+											(double) CLOCKS_PER_SEC);
+								pcbContainer[processIndex].setProcessDuration(duration);
+								okToContinue = handleQueued(readyQueue
+															 [prevFrontIndex][0],
+														    pcbContainer[processIndex]);
+								if (hasInstruction(prevFrontIndex))
+								{
+									readyQueue[prevFrontIndex].pop_front();
+								}
+								currentProcess.pop_front();
+							}
+							if (hasInstruction(prevFrontIndex) && 
+								!currentProcess.empty() && 
+								currentProcess[0].getCode() == 'P')
+							{
+								pcbContainer[processIndex].setInterruptOccurred(0);
+								duration = ((simulatedTicks() - start) / 
+											(double) CLOCKS_PER_SEC);
+								pcbContainer[processIndex].setProcessDuration(duration);
+								okToContinue = handleQueued(readyQueue
+															 [prevFrontIndex][0],
+															pcbContainer[processIndex]);
+								pcbContainer.setInterrupt(processIndex, 0);
+								pcbContainer[processIndex].setInterruptOccurred(1);
+							}
+							ableToReorder = true;
+							
+						}
+						else
+						{
+							if (hasInstruction(0))
+							{
+								readyQueue[0].pop_front();
+							}
+						}
+						if (!currentProcess.empty())
+						{
+							currentProcess.pop_front();
+						}
+					}
+					else
+					{
+						
+					}
+				
+				}
+				else
+				{
+					if (pcbContainer.isInterrupted(processIndex))
+					{
+						//cout << "check 1" << endl;
+						okToContinue = 0;
+					}
+					else
+					{
+						pthread_mutex_unlock(&mutexQueues);
+						interrupts.drain();
+						joinThreads();
+						logger.stop();
+						return 0;
+					}
+				}
+				duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+			}
+			//a process that ran out of instructions is done, even if it was interrupted
+			if (!readyQueue.empty() && readyQueue[0].empty())
+			{
+				//cout << "check" << endl;
+				if (!readyQueue.empty() && !loadedProcessIndeces.empty())
+				{
+					readyQueue.pop_front();
+					loadedProcessIndeces.pop_front();
+				}
+			}
+		}
+	}
+	pthread_mutex_unlock(&mutexQueues);
+	
+	//waits for every thread of the run, completions held back for coalescing included
+	interrupts.drain();
+	joinThreads();
+	
+	//every process has left the ready queue, the last one handled ends the program
+	int lastProcessIndex = processIndex;
+		
+	duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+	pcbContainer[lastProcessIndex].setProcessDuration(duration);
+	programDuration = duration;
+	
+	MetaData systemFinish;
+	systemFinish.setData('S', "finish", 0, 0);
+	handleProcess(systemFinish, pcbContainer[lastProcessIndex]);
+	
+	//every event has reached the metrics once the log is drained
+	logger.stop();
+	if (configData.getDecisionLogMode() == DECISIONS_RECORD)
+	{
+		ofstream decisionFile(configData.getDecisionLogPath().c_str());
+		if (!decisionFile.is_open() || !decisions.save(decisionFile))
+		{
+			cout << "ERROR: Decision log " << configData.getDecisionLogPath()
+				 << " could not be written" << endl;
+		}
+	}
+	if (outputType != 1)
+	{
+		metrics.print(cout, programDuration);
+		deviceStats.print(cout, programDuration);
+		latencies.print(cout);
+		diskModel.print(cout);
+		dispatcher.print(cout);
+		bufferCache.print(cout);
+		interrupts.print(cout);
+		waiter.print(cout);
+		decisions.print(cout);
+		profiler.print(cout, programDuration);
+	}
+	if (outputType == 1 || outputType == 2)
+	{
+		metrics.print(fout, programDuration);
+		deviceStats.print(fout, programDuration);
+		latencies.print(fout);
+		diskModel.print(fout);
+		dispatcher.print(fout);
+		bufferCache.print(fout);
+		interrupts.print(fout);
+		waiter.print(fout);
+		decisions.print(fout);
+		profiler.print(fout, programDuration);
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: runAnalytic
+*	Description: Works out the program in instructionSet on the virtual clock of an 
+*		EventEngine instead of running it with threads, if it can be worked out in 
+*		closed form (see EventEngine::evaluate()), and logs its events and metrics 
+*		the way runProgram() does, at the times they would happen. The other reports 
+*		of runProgram() are measured on the running threads, so they are left out 
+*		and the output says so. Returns false, with nothing logged, if the program 
+*		has to be run.
+*/
+bool Simulator::runAnalytic(deque<MetaData> instructionSet)
+{
+
+	EventEngine engine(configData);
+	EngineResult result;
+	int processCount = engine.load(instructionSet);
+	if (!engine.evaluate(result))
+	{
+		return 0;
+	}
+	
+	metrics.reset(processCount);
+	if (!logger.start(outputType, &cout, &fout))
+	{
+		return 0;
+	}
+	programDuration = result.makespan / 1000.0;
+	logger.log(0, EVENT_SIMULATOR_START);
+	engine.addSink(&logger);
+	engine.flushEvaluation();
+	logger.log(programDuration, EVENT_SIMULATOR_END);
+	logger.stop();
+	
+	//no threads, devices or timers ran, so only the metrics of the events are known
+	const char* omitted = "Analytic run: worked out in closed form, so the device "
+		"telemetry, operation latency,\ndisk scheduling, device dispatch, buffer cache, "
+		"interrupt, timer wait, scheduling\ndecision and profile reports of a "
+		"simulated run are not produced\n";
+	if (outputType != 1)
+	{
+		metrics.print(cout, programDuration);
+		cout << omitted;
+	}
+	if (outputType == 1 || outputType == 2)
+	{
+		metrics.print(fout, programDuration);
+		fout << omitted;
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: handleProcess
+*	Description: chooses, based on the process being passed as argument, what handler 
+*		to use for the process. Will call either systemHandler(), applicationHandler(), 
+*		processorHandler(), memoryHandler(), inputHandler(), or outputHandler() 
+*		depending on the type of process. Also takes cData and pData as parameters to 
+*		pass to the other handlers
+*/
+bool Simulator::handleProcess(MetaData process, PCB& pData)
+{
+
+	ProfileScope scope(&profiler, PROFILE_HANDLE_PROCESS);
+	
+	switch ((int) process.getCode())
+	{
+	
+		case (int) 'S':
+		
+			return systemHandler(pData, process.getDescriptor());
+		
+		break;
+		
+		case (int) 'A':
+		
+			return applicationHandler(pData, process.getDescriptor());
+		
+		break;
+		
+		case (int) 'P':
+		
+			return processorHandler(pData, process.getTotalTime());
+		
+		break;
+		
+		case (int) 'M':
+		
+			return memoryHandler(pData, process.getDescriptor(), process.getTotalTime());
+		
+		break;
+		
+		case (int) 'I':
+		
+			return inputHandler(pData, process.getDescriptor(), process.getTotalTime(),
+								process.getBlockAddress());
+					
+		break;
+		
+		case (int) 'O':
+		
+			return outputHandler(pData, process.getDescriptor(), 
+				   				 process.getTotalTime(), process.getBlockAddress());
+		
+		break;
+		
+		default:
+		
+			cout << "ERROR: Invalid code encountered in Meta Data" << endl;
+			return 0;
+	
+	}
+
+}
+
+/**
+*	Function: hasInstruction
+*	Description: Returns true if the ready queue has a process at queueIndex with an 
+*		instruction left. The caller holds mutexQueues.
+*/
+bool Simulator::hasInstruction(int queueIndex)
+{
+
+	return queueIndex < readyQueue.size() && !readyQueue[queueIndex].empty();
+
+}
+
+/**
+*	Function: handleQueued
+*	Description: Calls handleProcess() for an instruction of the ready queue. The 
+*		caller holds mutexQueues, which is released while the instruction runs so the 
+*		loader and the round robin thread can change the queues in the meantime.
+*/
+bool Simulator::handleQueued(MetaData process, PCB& pData)
+{
+
+	bool ok;
+	
+	pthread_mutex_unlock(&mutexQueues);
+	ok = handleProcess(process, pData);
+	pthread_mutex_lock(&mutexQueues);
+	
+	return ok;
+
+}
+
+/**
+*	Function: systemHandler
+*	Description: Prepares and starts the system as well as ends it. Updates the 
+*		duration of the process contained in the process' PCB. 
+*/
+bool Simulator::systemHandler(PCB& pData, string descriptor)
+{
+
+	if (descriptor == "begin")
+	{
+		//using switch statement to output to file, monitor, or both
+		logger.log(pData.getProcessDuration(), EVENT_SIMULATOR_START);
+	}
+	else if (descriptor == "finish")
+	{
+		logger.log(pData.getProcessDuration(), EVENT_SIMULATOR_END);
+		
+		blockCount = 0;
+		lastAddress = 0;	
+	}
+	else
+	{
+		cout << "ERROR: Incorrect descriptor recorded for Meta-Data code 'S'" << endl;
+		return 0;
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: applicationHandler
+*	Description: Prepares and starts a process as well as ends it. Updates the duration 
+*		of the process contained in the process' PCB. 
+*/
+bool Simulator::applicationHandler(PCB& pData, string descriptor)
+{
+
+	clock_t start;
+	int pid = pData.getpid();
+	double duration;
+	
+	start = simulatedTicks();
+	
+	if (descriptor == "begin")
+	{
+		logger.log(pData.getProcessDuration(), EVENT_PROCESS_PREPARE, pid);
+		duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+		pData.updateProcessDuration(duration);
+		pData.setStartTime(pData.getProcessDuration());
+		pData.processState = 1;
+		logger.log(pData.getProcessDuration(), EVENT_PROCESS_START, pid);
+	}
+	else if (descriptor == "finish")
+	{
+		logger.log(pData.getProcessDuration(), EVENT_PROCESS_END, pid);
+		pData.processState = 4;
+	}
+	else
+	{
+		cout << "ERROR: Incorrect descriptor recorded for Meta-Data code 'A'" << endl;
+		return 0;
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: processorHandler
+*	Description: Runs a process for the correct amount of time by using a timer thread. 
+*		While the thread counts down, executes the process. Currently there is nothing 
+*		else to be executed. Updates the duration of the process contained in the 
+*		process' PCB. 
+*/
+bool Simulator::processorHandler(PCB& pData, int processTime)
+{
+
+	clock_t start;
+	long pTime = (long) processTime;
+	double duration, elapsed;
+	int pid = pData.getpid();
+	int slot = pcbContainer.slotOf(pid);
+	
+	start = simulatedTicks();
+	
+	if (pData.hasBeenInterrupted())
+	{
+		duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+		pData.updateProcessDuration(duration);
+		pcbContainer.setInterrupt(slot, 0);
+		pTime = pTime - pData.loadState();
+		logger.log(pData.getProcessDuration(), EVENT_PROCESSING_RESUME, pid);
+		pData.processState = 2;
+		activeProcesses++;
+		startWorker(&Simulator::processThread, pTime, 0);
+		
+		while (true)
+		{
+	
+			if (activeProcesses == 0)
+			{
+				break;
+			}
+			else if (pcbContainer.isInterrupted(slot))
+			{
+				pData.processState = 1;
+				duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - 
+							   duration;
+				pData.updateProcessDuration(duration);
+				pData.saveState(duration);
+				pcbContainer.setRemaining(slot, pData.getEstimatedProcessTime() - 
+							  	(pData.getProcessDuration() - pData.getStartTime()));
+				logger.log(pData.getProcessDuration(), EVENT_PROCESSING_INTERRUPT, pid);
+				profiler.addPlanned(PROFILE_HANDLE_PROCESS, (long) (duration * 1000));
+				return 0;
+			}
+			
+			//ending process
+			pData.processState = 1;
+			duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - 
+						   duration;
+			pData.updateProcessDuration(duration);
+			logger.log(pData.getProcessDuration(), EVENT_PROCESSING_END, pid);
+			elapsed = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+			latencies.record(OPERATION_PROCESSOR, pTime / 1000.0, elapsed);
+			//a resumed run can finish early, only an overrun counts as overhead
+			profiler.addPlanned(PROFILE_HANDLE_PROCESS, 
+								 min(pTime, (long) (elapsed * 1000)));
+	
+			return 1;
+	
+		}
+	
+	}
+	
+	//preparing process
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	pData.updateProcessDuration(duration);
+	logger.log(pData.getProcessDuration(), EVENT_PROCESSING_START, pid);
+	
+	//running process
+	pData.processState = 2;
+	activeProcesses++;
+	startWorker(&Simulator::processThread, pTime, 0);
+	
+	//more functionality would go here
+	while (true)
+	{
+	
+		if (activeProcesses == 0)
+		{
+			break;
+		}
+		else if (pcbContainer.isInterrupted(slot))
+		{
+			pData.processState = 1;
+			duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - 
+						   duration;
+			pData.updateProcessDuration(duration);
+			pData.saveState(duration);
+			pcbContainer.setRemaining(slot, pData.getEstimatedProcessTime() - 
+							  	(pData.getProcessDuration() - pData.getStartTime()));
+			logger.log(pData.getProcessDuration(), EVENT_PROCESSING_INTERRUPT, pid);
+			profiler.addPlanned(PROFILE_HANDLE_PROCESS, (long) (duration * 1000));
+			return 0;
+		}
+	
+	}
+	
+	//ending process
+	pData.processState = 1;
+	duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+	pData.updateProcessDuration(duration);
+	logger.log(pData.getProcessDuration(), EVENT_PROCESSING_END, pid);
+	elapsed = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	latencies.record(OPERATION_PROCESSOR, pTime / 1000.0, elapsed);
+	//a resumed run can finish early, only an overrun counts as overhead
+	profiler.addPlanned(PROFILE_HANDLE_PROCESS, min(pTime, (long) (elapsed * 1000)));
+	
+	return 1;
+
+}
+
+/**
+*	Function: memoryHandler
+*	Description: Runs a memory process for the correct amount of time by using a timer 
+*		thread. While the thread counts down, generates an address location to allocate 
+*		memory to. Updates the duration of the process contained in the process' PCB. 
+*/
+bool Simulator::memoryHandler(PCB& pData, string descriptor, int processTime)
+{
+
+	pthread_t timerThread;
+	clock_t start;
+	long pTime = (long) processTime;
+	double duration;
+	int rc, pid = pData.getpid();
+	
+	start = simulatedTicks();
+	
+	if (descriptor == "allocate")
+	{
+		unsigned int addr;
+	
+		//preparing process
+		duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+		pData.updateProcessDuration(duration);
+		logger.log(pData.getProcessDuration(), EVENT_MEMORY_ALLOCATE_START, pid, 
+				   DEVICE_MEMORY);
+		
+		//running process
+		pData.processState = 2;
+		rc = createThread(&timerThread, &timer, timerArgument(pTime));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+		
+		//addr = generateMemoryAddress();
+		addr = allocateMemory(pData);
+		if (addr == -1)
+		{
+			cout << "ERROR: memory allocation failed" << endl;
+			return 0;
+		}
+		
+		pthread_join(timerThread, NULL);
+		
+		//ending process
+		pData.processState = 1;
+		duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+		pData.updateProcessDuration(duration);
+		logger.log(pData.getProcessDuration(), EVENT_MEMORY_ALLOCATE_END, pid, 
+				   DEVICE_MEMORY, -1, addr);
+		latencies.record(OPERATION_MEMORY_ALLOCATE, pTime / 1000.0, 
+						 (simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+		profiler.addPlanned(PROFILE_HANDLE_PROCESS, pTime);
+		
+	}
+	else if (descriptor == "block")
+	{
+	
+		//preparing process
+		duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+		pData.updateProcessDuration(duration);
+		logger.log(pData.getProcessDuration(), EVENT_MEMORY_BLOCK_START, pid, 
+				   DEVICE_MEMORY);
+	
+		//running process
+		pData.processState = 2;
+		rc = createThread(&timerThread, &timer, timerArgument(pTime));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+	
+		//more functionality would go here
+	
+		pthread_join(timerThread, NULL);
+	
+		//ending process
+		pData.processState = 1;
+		duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+		pData.updateProcessDuration(duration);
+		logger.log(pData.getProcessDuration(), EVENT_MEMORY_BLOCK_END, pid, 
+				   DEVICE_MEMORY);
+		latencies.record(OPERATION_MEMORY_BLOCK, pTime / 1000.0, 
+						 (simulatedTicks() - start) / (double) CLOCKS_PER_SEC);
+		profiler.addPlanned(PROFILE_HANDLE_PROCESS, pTime);
+		
+	}
+	else
+	{
+		cout << "ERROR: Incorrect descriptor recorded for Meta-Data code 'M'" << endl;
+		return 0;
+	}
+	
+	return 1;
+
+}
+
+/**
+*	Function: inputHandler
+*	Description: Runs a process for an input device for the correct amount of time by 
+*		using a timer thread. While the thread counts down, executes the process in 
+*		another thread. Currently there is nothing else to be executed. Updates the 
+*		duration of the process contained in the process' PCB. Hard drive requests 
+*		are queued on their drive for blockAddress (-1 if the instruction names none).
+*/
+bool Simulator::inputHandler(PCB& pData, string descriptor, int processTime, 
+							 int blockAddress)
+{
+
+	clock_t start;
+	long pTime = (long) processTime;
+	double duration;
+	int pid = pData.getpid();
+	int device = MetaData::lookupDeviceId('I', descriptor);
+	
+	start = simulatedTicks();
+	
+	//preparing process
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	pData.updateProcessDuration(duration);
+	if (descriptor == "hard drive" && cacheRequest('I', processTime, blockAddress, 
+												   pTime))
+	{
+	
+		//served from the buffer cache, the drive never sees the request
+		logger.log(pData.getProcessDuration(), EVENT_INPUT_START, pid, device);
+		pData.processState = 2;
+		interrupts.expect();
+		startWorker(&Simulator::cacheInputHandler, pTime, pid - 1);
+		pData.processState = 3;
+		return 1;
+	
+	}
+	else if (descriptor == "keyboard" || descriptor == "scanner")
+	{
+		//the request joins the queue of its unit before its thread starts
+		int unit;
+		pTime = dispatcher.submit(pid, device, pData.getDevicesUsed(device), pTime,
+								  unit);
+		logger.log(pData.getProcessDuration(), EVENT_INPUT_START, pid, device, 
+				   dispatcher.getUnitCount(device) > 1 ? unit : -1);
+		pData.incrementDevicesUsed(device);
+	}
+	else if (descriptor != "hard drive")
+	{
+		logger.log(pData.getProcessDuration(), EVENT_INPUT_START, pid, device);
+	}
+	else
+	{
+		//the request joins the queue of its drive before its thread starts
+		int hddIndex = dispatcher.assign(pid, DEVICE_HARD_DRIVE,
+										 pData.getHardDrivesUsed());
+		logger.log(pData.getProcessDuration(), EVENT_INPUT_START, pid, device, 
+				   hddIndex);
+		pData.incrementHardDrivesUsed();
+		pTime = diskModel.submit(hddIndex, pid, blockAddress, pTime);
+	}
+	
+	int ioIndex = pData.getpid() - 1;
+	
+	if (descriptor == "hard drive")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::hardDriveInputHandler, pTime, ioIndex);
+	
+	}
+	else if (descriptor == "keyboard")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::keyboardHandler, pTime, ioIndex);
+	
+	}
+	else if (descriptor == "scanner")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::scannerHandler, pTime, ioIndex);
+	
+	}
+	else
+	{
+		cout << "ERROR: Incorrect descriptor recorded for Meta-Data code 'I'" << endl;
+		return 0;
+	}
+	
+	//the thread raises its completion interrupt when the device is done
+	interrupts.expect();
+	
+	//process is waiting
+	pData.processState = 3;
+	
+	return 1;
+
+}
+
+/**
+*	Function: outputHandler
+*	Description: Runs a process for an output device for the correct amount of time by 
+*		using a timer thread. While the thread counts down, executes the process in 
+*		another thread. Currently there is nothing else to be executed. Updates the 
+*		duration of the process contained in the process' PCB. Hard drive requests 
+*		are queued on their drive for blockAddress (-1 if the instruction names none).
+*/
+bool Simulator::outputHandler(PCB& pData, string descriptor, int processTime, 
+							  int blockAddress)
+{
+
+	clock_t start;
+	long pTime = (long) processTime;
+	double duration;
+	int pid = pData.getpid();
+	int device = MetaData::lookupDeviceId('O', descriptor);
+	
+	start = simulatedTicks();
+	
+	//preparing process
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	pData.updateProcessDuration(duration);
+	if (descriptor == "hard drive" && cacheRequest('O', processTime, blockAddress, 
+												   pTime))
+	{
+	
+		//served from the buffer cache, the drive never sees the request
+		logger.log(pData.getProcessDuration(), EVENT_OUTPUT_START, pid, device);
+		pData.processState = 2;
+		interrupts.expect();
+		startWorker(&Simulator::cacheOutputHandler, pTime, pid - 1);
+		pData.processState = 3;
+		return 1;
+	
+	}
+	else if (descriptor == "monitor")
+	{
+	
+		//the request joins the queue of its monitor before its thread starts
+		int unit;
+		pTime = dispatcher.submit(pid, DEVICE_MONITOR, pData.getDevicesUsed(device),
+								  pTime, unit);
+		logger.log(pData.getProcessDuration(), EVENT_OUTPUT_START, pid, device, 
+				   dispatcher.getUnitCount(device) > 1 ? unit : -1);
+		pData.incrementDevicesUsed(device);
+	
+	}
+	else if (descriptor != "hard drive" && descriptor != "projector")
+	{
+	
+		logger.log(pData.getProcessDuration(), EVENT_OUTPUT_START, pid, device);
+		
+	}
+	else if (descriptor == "hard drive")
+	{
+	
+		//the request joins the queue of its drive before its thread starts
+		int hddIndex = dispatcher.assign(pid, DEVICE_HARD_DRIVE,
+										 pData.getHardDrivesUsed());
+		logger.log(pData.getProcessDuration(), EVENT_OUTPUT_START, pid, device, 
+				   hddIndex);
+		pData.incrementHardDrivesUsed();
+		pTime = diskModel.submit(hddIndex, pid, blockAddress, pTime);
+	
+	}
+	else if (descriptor == "projector")
+	{
+	
+		//the request joins the queue of its projector before its thread starts
+		int projIndex;
+		pTime = dispatcher.submit(pid, DEVICE_PROJECTOR, pData.getProjectorsUsed(),
+								  pTime, projIndex);
+		logger.log(pData.getProcessDuration(), EVENT_OUTPUT_START, pid, device, 
+				   projIndex);
+		pData.incrementProjectorsUsed();
+	
+	}
+	
+	int ioIndex = pData.getpid() - 1;
+	
+	if (descriptor == "hard drive")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::hardDriveOutputHandler, pTime, ioIndex);
+	
+	}
+	else if (descriptor == "monitor")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::monitorHandler, pTime, ioIndex);
+	
+	}
+	else if (descriptor == "projector")
+	{
+	
+		//running process, pTime is the ticket of the request
+		pData.processState = 2;
+		startWorker(&Simulator::projectorHandler, pTime, ioIndex);
+	
+	}
+	else
+	{
+		cout << "ERROR: Incorrect descriptor recorded for Meta-Data code 'I'" << endl;
+		return 0;
+	}
+	
+	//the thread raises its completion interrupt when the device is done
+	interrupts.expect();
+	
+	//process is waiting
+	pData.processState = 3;
+	
+	//ending process
+	/*pData.processState = 1;
+	duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+	pData.updateProcessDuration(duration);
+	switch (outputType)
+	{
+		case 0:
+			cout << pData.getProcessDuration() << " - Process " << pid << 
+			": end " << descriptor << " output" << endl;
+		break;
+		case 1:
+			fout << pData.getProcessDuration() << " - Process " << pid << 
+			": end " << descriptor << " output" << endl;
+		break;
+		case 2:
+			cout << pData.getProcessDuration() << " - Process " << pid << 
+			": end " << descriptor << " output" << endl;
+			fout << pData.getProcessDuration() << " - Process " << pid << 
+			": end " << descriptor << " output" << endl;
+		break;
+		default:
+			cout << "ERROR: Incorrect log type recorded from config file" << endl;
+			return 0;
+	}*/
+	
+	return 1;
+
+}
+
+/**
+*	Function: cacheRequest
+*	Description: Passes a hard drive request of processTime (msec) for the blocks from 
+*		blockAddress through the buffer cache, reading them if code is 'I' and writing 
+*		them otherwise. Returns true if the cache serves the request alone and stores 
+*		the time (msec) it takes in pTime. Otherwise stores the first block and the 
+*		time (msec) of the request the drive still has to serve, the copy to memory 
+*		included, in blockAddress and pTime. Requests without a block bypass the cache.
+*/
+bool Simulator::cacheRequest(char code, int processTime, int& blockAddress, long& pTime)
+{
+
+	int cycleTime = configData.getHardDriveTime();
+	if (!bufferCache.isEnabled() || blockAddress < 0 || cycleTime <= 0)
+	{
+		return 0;
+	}
+	
+	//every cycle of the instruction moves one block
+	CacheAccess access;
+	if (code == 'I')
+	{
+		bufferCache.read(blockAddress, processTime / cycleTime, access);
+	}
+	else
+	{
+		bufferCache.write(blockAddress, processTime / cycleTime, access);
+	}
+	if (access.diskBlocks == 0)
+	{
+		pTime = access.memoryTime;
+		return 1;
+	}
+	
+	blockAddress = access.diskBlock;
+	pTime = access.diskBlocks * (long) cycleTime + access.memoryTime;
+	return 0;
+
+}
+
+/**
+*	Function: prioritySchedule
+*	Description: Schedules processes based on number of input/output operations. 
+*		Places processes into deque called program
+*/
+void Simulator::prioritySchedule(deque<deque<MetaData>> processStorage)
+{
+
+	ProfileScope scope(&profiler, PROFILE_SCHEDULING);
+	
+	int processIOCounters[processStorage.size()];
+	
+	program.clear();
+	
+	//count io operations in each process and store in an array
+	for (int i = 0; i < processStorage.size(); i++)
+	{
+		processIOCounters[i] = 0;
+		for (int j = 0; j < processStorage[i].size(); j++)
+		{
+			if (processStorage[i][j].getCode() == 'I' || 
+				processStorage[i][j].getCode() == 'O')
+			{
+				processIOCounters[i]++;
+			}
+		}
+	}
+	
+	//sort processes by processIOCounters
+	int largestIOValue, largestIOIndex = 0;
+	for (int i = 0; i < processStorage.size(); i++)
+	{
+		largestIOValue = -1;
+		for (int j = 0; j < processStorage.size(); j++)
+		{
+			if (processIOCounters[j] > largestIOValue)
+			{
+				largestIOValue = processIOCounters[j];
+				largestIOIndex = j;
+			}
+		}
+		program.push_back(processStorage[largestIOIndex]);
+		waitingProcessIndeces.push_back(largestIOIndex);
+		processIOCounters[largestIOIndex] = -1;
+	}
+
+}
+
+/**
+*	Function: shortestJobFirst
+*	Description: Schedules process based on number of tasks in each process. Sorts 
+*		them from least number of tasks to most number of tasks. Places processes 
+*		into deque called program. 
+*/
+void Simulator::shortestJobFirstSchedule(deque<deque<MetaData>> processStorage)
+{
+
+	ProfileScope scope(&profiler, PROFILE_SCHEDULING);
+	
+	program.clear();
+	
+	//sort processes by amount of tasks
+	int largestNumOfTasks = 0, lastLargestNumOfTasks = 0;
+	int largestIndex = 0, lastLargestIndex = 0;;
+	for (int i = 0; i < processStorage.size(); i++)
+	{
+		largestNumOfTasks = 0;
+		for (int j = 0; j < processStorage.size(); j++)
+		{
+			if (i == 0)
+			{
+				if (processStorage[j].size() > largestNumOfTasks)
+				{
+					largestNumOfTasks = processStorage[j].size();
+					largestIndex = j;
+				}
+			}
+			else
+			{
+				if (processStorage[j].size() > largestNumOfTasks &&
+					processStorage[j].size() <= lastLargestNumOfTasks &&
+					j != lastLargestIndex)
+				{
+					largestNumOfTasks = processStorage[j].size();
+					largestIndex = j;
+				}
+			}
+		}
+		
+		program.push_front(processStorage[largestIndex]);
+		waitingProcessIndeces.push_front(largestIndex);
+		lastLargestNumOfTasks = largestNumOfTasks;
+		lastLargestIndex = largestIndex;
+	}
+
+}
+
+void Simulator::shortestTimeRemainingSchedule(deque<deque<MetaData>> processStorage, 
+												 deque<int> indexStorage)
+{
+
+	ProfileScope scope(&profiler, PROFILE_SCHEDULING);
+	
+	deque<deque<MetaData>> tempReadyQueue;
+	deque<int> tempLoadedProcessIndeces;
+	
+	//sort processes by shortest time remaining
+	double mostTimeRemaining, lastMostTimeRemaining;
+	int mostTimeIndex, largestIndex, lastLargestIndex;
+	const double* remaining = pcbContainer.getRemainingColumn();
+	for (int i = 0; i < processStorage.size(); i++)
+	{	
+		mostTimeRemaining = 0;
+		for (int j = 0; j < processStorage.size(); j++)
+		{
+			double etr = remaining[indexStorage[j]];
+			if (i == 0)
+			{
+				if (etr > mostTimeRemaining)
+				{
+					mostTimeRemaining = etr;
+					mostTimeIndex = indexStorage[j];
+					largestIndex = j;
+				}
+			}
+			else
+			{
+				if (etr > mostTimeRemaining && etr <= lastMostTimeRemaining && 
+					j != lastLargestIndex)
+				{
+					mostTimeRemaining = etr;
+					mostTimeIndex = indexStorage[j];
+					largestIndex = j;
+				}
+			}
+		}
+		
+		tempReadyQueue.push_front(processStorage[largestIndex]);
+		tempLoadedProcessIndeces.push_front(mostTimeIndex);
+		lastMostTimeRemaining = mostTimeRemaining;
+		lastLargestIndex = largestIndex;
+	}
+	
+	if (tempLoadedProcessIndeces[0] != loadedProcessIndeces[0])
+	{
+		//cout << "interrupt received" << endl;
+		decisions.record(DECISION_PREEMPT, 0, DEVICE_PROCESSOR,
+						 loadedProcessIndeces[0] + 1);
+		pcbContainer.interrupt(loadedProcessIndeces[0]);
+		interruptOccurred = true;
+		for (int i = 0; i < tempLoadedProcessIndeces.size(); i++)
+		{
+			if (loadedProcessIndeces[0] == tempLoadedProcessIndeces[i])
+			{
+				prevFrontIndex = i;
+			}
+		}
+	}
+	readyQueue = tempReadyQueue;
+	loadedProcessIndeces = tempLoadedProcessIndeces;
+	
+	/*for (int i = 0; i < loadedProcessIndeces.size(); i++)
+	{
+	
+		cout << loadedProcessIndeces[i] + 1 << " ";
+	
+	}
+	cout << endl;*/
+
+}
+
+/**
+*	Function: createThread
+*	Description: Creates a thread with default attributes that runs entry with the 
+*		parameter argument, charging the time taken to the thread creation section of 
+*		the profile. Returns the return code of pthread_create().
+*/
+int Simulator::createThread(pthread_t* thread, void* (*entry)(void*), void* argument)
+{
+
+	ProfileScope scope(&profiler, PROFILE_THREAD_CREATE);
+	return pthread_create(thread, NULL, entry, argument);
+
+}
+
+/**
+*	Function: startWorker
+*	Description: Starts a thread that runs task with the parameters taskTime and 
+*		pcbIndex (see taskThread()) and keeps its handle, so that joinThreads() can 
+*		wait for it at the end of the run. Only called by the thread running the 
+*		program.
+*/
+void Simulator::startWorker(Task task, long taskTime, int pcbIndex)
+{
+
+	pthread_t thread;
+	int rc = createThread(&thread, &taskThread, new ThreadTask(this, task, taskTime, 
+															   pcbIndex));
+	if (rc)
+	{
+		cout << "ERROR: return code from pthread_create() is " << rc << endl;
+		exit(-1);
+	}
+	workerThreads.push_back(thread);
+
+}
+
+/**
+*	Function: joinThreads
+*	Description: Waits for every thread the run started to finish: the processor and 
+*		device threads, the loader, and the round robin and sampling threads, which are 
+*		told to stop first. Leaves no thread of the run behind, so the simulator can 
+*		run another program.
+*/
+void Simulator::joinThreads()
+{
+
+	for (int i = 0; i < workerThreads.size(); i++)
+	{
+		pthread_join(workerThreads[i], NULL);
+	}
+	workerThreads.clear();
+	
+	if (scheduleType == 4)
+	{
+		roundRobinDone.store(true);
+		pthread_join(rrThread, NULL);
+	}
+	pthread_join(loadThread, NULL);
+	if (configData.getDeviceSampleInterval() > 0)
+	{
+		samplingDone.store(true);
+		pthread_join(sampleThread, NULL);
+	}
+
+}
+
+/**
+*	Function: generateMemoryAddress
+*	Description: Generates a random unsigned int to be used as a memory address 
+*		location. The numbers repeat for runs with the same seed, see DecisionLog.
+*/
+unsigned int Simulator::generateMemoryAddress()
+{
+
+	//generating and assigning random integer value to address
+	unsigned int address;
+	
+	address = random() % UINT_MAX;
+	return address;
+
+}
+
+/**
+*	Function: allocateMemory
+*	Description: allocates amount of memory specified in cData to the location 
+*		specified in pData which stores the last memory address used. If max memory is 
+*		reached or if no memory is allocated, the next address will be at location 0. 
+*		After the memory is allocated, updates pData. Returns -1 if the address is 
+*		below 0 or if the address is above the max system memory to signify an error.
+*/
+int Simulator::allocateMemory(PCB& pData)
+{
+
+	int addressIndex, nextAddress;
+	if (blockCount == 0)
+	{
+		addressIndex = 0;
+	}
+	else
+	{
+		addressIndex = lastAddress;
+	}
+	nextAddress = (addressIndex + configData.getBlockSize()) % configData.getSystemMemory();
+	lastAddress = nextAddress;
+	blockCount++;;
+	
+	if (addressIndex < 0 || addressIndex > configData.getSystemMemory())
+	{
+		return -1;
+	}
+	else return addressIndex;
+
+}
+
+/**
+*	Function: timer
+*	Description: A thread that runs out the timer request passed as parameter (see 
+*		timerArgument()) with the precise waiter of its simulator. Thread is exited 
+*		once the timer is finished.
+*/
+void* Simulator::timer(void* request)
+{
+
+	TimerRequest* r = (TimerRequest*) request;
+	r->waiter->wait(r->microseconds * 1000);
+	delete r;
+	
+	return NULL;
+
+}
+
+/**
+*	Function: timerArgument
+*	Description: returns the argument of timer() that runs out milliseconds of 
+*		simulated time, which take milliseconds times the time scale in real time. 
+*		timer() deletes it.
+*/
+void* Simulator::timerArgument(long milliseconds)
+{
+
+	TimerRequest* request = new TimerRequest;
+	request->waiter = &waiter;
+	request->microseconds = (long long) (milliseconds * 1000 * timeScale + 0.5);
+	return request;
+
+}
+
+/**
+*	Function: checkTimeScale
+*	Description: Measures the real time a timer thread costs the simulator when it 
+*		runs out no time at all. That overhead is not scaled, so each operation 
+*		measures it divided by the time scale on top of its own time. Returns false, 
+*		with an error, if a time scale below 1 leaves the shortest operation of 
+*		instructionSet less real time than the overhead, since its simulated time would
+*		then mostly be overhead.
+*/
+bool Simulator::checkTimeScale(deque<MetaData>& instructionSet)
+{
+
+	const int samples = 8;
+	pthread_t timerThread;
+	int shortest = INT_MAX;
+	int rc;
+	
+	if (timeScale >= 1)
+	{
+		return 1;
+	}
+	for (int i = 0; i < instructionSet.size(); i++)
+	{
+		if (instructionSet[i].getTotalTime() > 0)
+		{
+			shortest = min(shortest, instructionSet[i].getTotalTime());
+		}
+	}
+	if (shortest == INT_MAX)
+	{
+		return 1;
+	}
+	
+	clock_t start = clockTicks();
+	for (int i = 0; i < samples; i++)
+	{
+		rc = createThread(&timerThread, &timer, timerArgument(0));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+		pthread_join(timerThread, NULL);
+	}
+	double overhead = (clockTicks() - start) * 1000000.0 / CLOCKS_PER_SEC / samples;
+	double available = shortest * 1000 * timeScale;
+	
+	if (overhead > available)
+	{
+		cout << "ERROR: Time scale " << timeScale << " leaves the shortest operation ("
+			 << shortest << " msec) " << available << " usec of real time, less than "
+			 << "the " << overhead << " usec a timer costs" << endl;
+		return 0;
+	}
+	return 1;
+
+}
+
+/**
+*	Function: taskThread
+*	Description: Entry point for threads that run a member function of a simulator. 
+*		The parameter task is a ThreadTask holding the simulator, the member function 
+*		to run and its arguments. The task is deleted once the member function returns.
+*/
+void* Simulator::taskThread(void* task)
+{
+
+	ThreadTask* t = (ThreadTask*) task;
+	void* result = (t->simulator->*(t->task))(t->taskTime, t->pcbIndex);
+	delete t;
+	return result;
+
+}
+
+/**
+*	Function: loaderThread
+*	Description: Entry point for the loader thread of the simulator passed as parameter
+*/
+void* Simulator::loaderThread(void* simulator)
+{
+
+	((Simulator*) simulator)->loader();
+	return NULL;
+
+}
+
+/**
+*	Function: rrHandlerThread
+*	Description: Entry point for the round robin thread of the simulator passed as 
+*		parameter
+*/
+void* Simulator::rrHandlerThread(void* simulator)
+{
+
+	((Simulator*) simulator)->rrHandler();
+	return NULL;
+
+}
+
+/**
+*	Function: clockTicks
+*	Description: Returns the time elapsed on the monotonic wall clock in units of 
+*		CLOCKS_PER_SEC. Used in place of clock(), which measures the processor time of 
+*		the whole process and therefore runs faster whenever more than one simulator 
+*		(or more than one spinning timer) is active.
+*/
+clock_t Simulator::clockTicks()
+{
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (clock_t) now.tv_sec * CLOCKS_PER_SEC + 
+		   (clock_t) now.tv_nsec / (1000000000 / CLOCKS_PER_SEC);
+
+}
+
+/**
+*	Function: simulatedTicks
+*	Description: Returns the time elapsed on the simulated clock in units of 
+*		CLOCKS_PER_SEC. The simulated clock is the monotonic wall clock divided by the 
+*		time scale, so a program compressed by the time scale still measures and logs 
+*		its operations in simulated milliseconds.
+*/
+clock_t Simulator::simulatedTicks()
+{
+
+	return (clock_t) (clockTicks() / timeScale);
+
+}
+
+/**
+*	Function: simulationTime
+*	Description: returns the simulated seconds elapsed since the program of this 
+*		simulator started running
+*/
+double Simulator::simulationTime()
+{
+
+	return (simulatedTicks() - programStart) / (double) CLOCKS_PER_SEC;
+
+}
+
+/**
+*	Function: samplerThread
+*	Description: Entry point for the device telemetry sampling thread of the simulator 
+*		passed as parameter
+*/
+void* Simulator::samplerThread(void* simulator)
+{
+
+	((Simulator*) simulator)->sampler();
+	return NULL;
+
+}
+
+/**
+*	Function: sampler
+*	Description: Takes a sample of the device telemetry every device sample interval 
+*		until the program finishes. Sleeps between samples instead of using the 
+*		spinning timer so that sampling does not take processor time from the 
+*		simulation.
+*/
+void Simulator::sampler()
+{
+
+	long interval = configData.getDeviceSampleInterval();
+	long nanoseconds = (long) (interval * timeScale * 1000000);
+	struct timespec wait = {nanoseconds / 1000000000, nanoseconds % 1000000000};
+	
+	while (!samplingDone.load())
+	{
+		nanosleep(&wait, NULL);
+		deviceStats.sample(simulationTime());
+	}
+
+}
+
+void Simulator::loader()
+{
+	pthread_t timerThread;
+	int rc;
+	
+	for (int i = 0; i < program.size(); i++)
+	{
+		if (i > 0)
+		{
+			rc = createThread(&timerThread, &timer, timerArgument(100));
+			if (rc)
+			{
+				cout << "ERROR: return code from pthread_create() is " << rc << endl;
+				exit(-1);
+			}
+			pthread_join(timerThread, NULL);
+		}
+		loadProgram();
+	}
+
+}
+
+void Simulator::rrHandler()
+{
+
+	pthread_t timerThread;
+	deque<MetaData> tempProcessHolder;
+	int tempIndexHolder, rc;
+	struct timespec idle = {0, 1000000};
+	
+	//the queues are left unlocked while the quantum runs out
+	pthread_mutex_lock(&mutexQueues);
+	while (!waitingQueue.empty() && !roundRobinDone.load())
+	{
+	
+		pthread_mutex_unlock(&mutexQueues);
+		rc = createThread(&timerThread, &timer, timerArgument(quantumNumber));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+		pthread_join(timerThread, NULL);
+		pthread_mutex_lock(&mutexQueues);
+		//while (!changesHaveBeenMade);
+	
+		if (readyQueue.size() > 1)
+		{
+			//while (!ableToReorder) {};
+			
+			if (!interruptOccurred)
+			{
+			
+				decisions.record(DECISION_PREEMPT, 0, DEVICE_PROCESSOR,
+								 loadedProcessIndeces[0] + 1);
+				pcbContainer.interrupt(loadedProcessIndeces[0]);
+				interruptOccurred = true;
+				tempProcessHolder = readyQueue[0];
+				tempIndexHolder = loadedProcessIndeces[0];
+			
+				readyQueue.pop_front();
+				loadedProcessIndeces.pop_front();
+				readyQueue.push_back(tempProcessHolder);
+				loadedProcessIndeces.push_back(tempIndexHolder);
+				prevFrontIndex = loadedProcessIndeces.size() - 1;
+			
+			}
+			
+		}
+		else
+		{
+			//sleeps until there is another process to switch to or the program ends
+			while (readyQueue.size() <= 1 && !roundRobinDone.load()) 
+			{
+				pthread_mutex_unlock(&mutexQueues);
+				nanosleep(&idle, NULL);
+				pthread_mutex_lock(&mutexQueues);
+			}
+		}
+	
+	}
+	pthread_mutex_unlock(&mutexQueues);
+
+}
+
+void* Simulator::processThread(long pTime, int)
+{
+
+	pthread_t timerThread;
+	int rc;
+	
+	//handlers that ran while the processor was idle took nothing from this process
+	interrupts.takeOwedTime();
+	
+	//the process gets the processor back only after the handlers that interrupted it
+	for (long time = pTime; time > 0; time = interrupts.takeOwedTime())
+	{
+		rc = createThread(&timerThread, &timer, timerArgument(time));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+		pthread_join(timerThread, NULL);
+	}
+	activeProcesses--;
+	
+	return NULL;
+
+}
+
+/**
+*	Function: hardDriveInputHandler
+*	Description: A thread that handles an input process from the hard drive, see 
+*	deviceHandler()
+*/
+void* Simulator::hardDriveInputHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_HARD_DRIVE, true);
+
+}
+
+/**
+*	Function: keyboardHandler
+*	Description: A thread that handles an input process from the keyboard, see 
+*	deviceHandler()
+*/
+void* Simulator::keyboardHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_KEYBOARD, true);
+
+}
+
+/**
+*	Function: scannerHandler
+*	Description: A thread that handles an input process from the scanner, see 
+*	deviceHandler()
+*/
+void* Simulator::scannerHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_SCANNER, true);
+
+}
+
+/**
+*	Function: hardDriveOutputHandler
+*	Description: A thread that handles an output process to the hard drive, see 
+*	deviceHandler()
+*/
+void* Simulator::hardDriveOutputHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_HARD_DRIVE, false);
+
+}
+
+/**
+*	Function: monitorHandler
+*	Description: A thread that handles an output process to the monitor, see 
+*	deviceHandler()
+*/
+void* Simulator::monitorHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_MONITOR, false);
+
+}
+
+/**
+*	Function: projectorHandler
+*	Description: A thread that handles an output process to the projector, see 
+*	deviceHandler()
+*/
+void* Simulator::projectorHandler(long ticket, int pcbIndex)
+{
+
+	return deviceHandler(ticket, pcbIndex, DEVICE_PROJECTOR, false);
+
+}
+
+/**
+*	Function: deviceHandler
+*	Description: Handles an input (if input is true) or output process on device for 
+*	the thread of the request with ticket. Waits until the unit the request was given 
+*	is free, or until a hard drive picks the request, then for the timer thread to run 
+*	out the time of the request (the seek, rotation and transfer time on a hard drive). 
+*	A hard drive request merged into another one ends when that one does. The request 
+*	ends through its completion interrupt.
+*/
+void* Simulator::deviceHandler(long ticket, int pcbIndex, int device, bool input)
+{
+
+	double requested = simulationTime();
+	deviceStats.requestArrived(device, requested);
+	int unit;
+	long deviceTime;
+	bool merged = false;
+	if (device == DEVICE_HARD_DRIVE)
+	{
+		deviceTime = diskModel.acquire(ticket, unit, merged);
+	}
+	else
+	{
+		unit = dispatcher.acquire(ticket, deviceTime);
+	}
+	double started = simulationTime();
+	deviceStats.requestStarted(device, started, requested, unit);
+	ProfileScope scope(&profiler, PROFILE_DEVICE);
+	
+	PCB process = pcbContainer[pcbIndex];
+	pthread_t timerThread;
+	clock_t start;
+	int rc;
+	double duration;
+	
+	start = simulatedTicks();
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	process.updateProcessDuration(duration);
+	
+	//a merged request was served by the operation of its batch leader, which has 
+	//already finished, so it completes along with it without a timer of its own
+	if (!merged)
+	{
+		rc = createThread(&timerThread, &timer, timerArgument(deviceTime));
+		if (rc)
+		{
+			cout << "ERROR: return code from pthread_create() is " << rc << endl;
+			exit(-1);
+		}
+		
+		pthread_join(timerThread, NULL);
+	}
+	
+	duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+	process.updateProcessDuration(duration);
+	
+	process.processState = 1;
+	
+	//the latency of each operation of each device is kept apart
+	int operation;
+	if (device == DEVICE_HARD_DRIVE)
+	{
+		operation = input ? OPERATION_HARD_DRIVE_INPUT : OPERATION_HARD_DRIVE_OUTPUT;
+	}
+	else if (device == DEVICE_KEYBOARD)
+	{
+		operation = OPERATION_KEYBOARD_INPUT;
+	}
+	else if (device == DEVICE_SCANNER)
+	{
+		operation = OPERATION_SCANNER_INPUT;
+	}
+	else if (device == DEVICE_MONITOR)
+	{
+		operation = OPERATION_MONITOR_OUTPUT;
+	}
+	else
+	{
+		operation = OPERATION_PROJECTOR_OUTPUT;
+	}
+	
+	double finished = simulationTime();
+	deviceStats.requestFinished(device, unit, finished);
+	latencies.record(operation, deviceTime / 1000.0, finished - started, 
+					 started - requested);
+	profiler.addPlanned(PROFILE_DEVICE, deviceTime);
+	if (device == DEVICE_HARD_DRIVE && !merged)
+	{
+		diskModel.release(unit);
+	}
+	dispatcher.release(device, unit);
+	
+	signalCompletion(process, input ? EVENT_INPUT_END : EVENT_OUTPUT_END, device, 
+					 unit);
+	
+	return NULL;
+
+}
+
+/**
+*	Function: cacheInputHandler
+*	Description: A thread that handles an input process from the hard drive that the 
+*	buffer cache serves, see cacheHandler()
+*/
+void* Simulator::cacheInputHandler(long cTime, int pcbIndex)
+{
+
+	return cacheHandler(cTime, pcbIndex, true);
+
+}
+
+/**
+*	Function: cacheOutputHandler
+*	Description: A thread that handles an output process to the hard drive that the 
+*	buffer cache serves, see cacheHandler()
+*/
+void* Simulator::cacheOutputHandler(long cTime, int pcbIndex)
+{
+
+	return cacheHandler(cTime, pcbIndex, false);
+
+}
+
+/**
+*	Function: cacheHandler
+*	Description: Waits for the timer thread to run out the time the blocks of a hard 
+*	drive request take to copy between the buffer cache and the process, then ends the 
+*	input or output through its completion interrupt like a device would. No drive is 
+*	used, so only the latency of the request is recorded.
+*/
+void* Simulator::cacheHandler(long cTime, int pcbIndex, bool input)
+{
+
+	double started = simulationTime();
+	ProfileScope scope(&profiler, PROFILE_DEVICE);
+	
+	PCB process = pcbContainer[pcbIndex];
+	pthread_t timerThread;
+	clock_t start;
+	int rc;
+	double duration;
+	
+	start = simulatedTicks();
+	duration = (simulatedTicks() - start) / (double) CLOCKS_PER_SEC;
+	process.updateProcessDuration(duration);
+	
+	rc = createThread(&timerThread, &timer, timerArgument(cTime));
+	if (rc)
+	{
+		cout << "ERROR: return code from pthread_create() is " << rc << endl;
+		exit(-1);
+	}
+	
+	pthread_join(timerThread, NULL);
+	
+	duration = ((simulatedTicks() - start) / (double) CLOCKS_PER_SEC) - duration;
+	process.updateProcessDuration(duration);
+	
+	process.processState = 1;
+	
+	double finished = simulationTime();
+	latencies.record(input ? OPERATION_HARD_DRIVE_INPUT : OPERATION_HARD_DRIVE_OUTPUT,
+					 cTime / 1000.0, finished - started, 0);
+	profiler.addPlanned(PROFILE_DEVICE, cTime);
+	
+	signalCompletion(process, input ? EVENT_INPUT_END : EVENT_OUTPUT_END,
+					 DEVICE_HARD_DRIVE, -1);
+	
+	return NULL;
+
+}
+
+/**
+*	Function: signalCompletion
+*	Description: Raises the completion interrupt of a request of process on unit of 
+*	device and waits for the interrupt controller to deliver it, then logs endEvent 
+*	and acknowledges the interrupt. Called by the device threads once the device is 
+*	free. unit is -1 for requests served without a unit.
+*/
+void Simulator::signalCompletion(PCB& process, int endEvent, int device, int unit)
+{
+
+	interrupts.complete();
+	logger.log(process.getProcessDuration(), endEvent, process.getpid(), device, unit);
+	interrupts.acknowledge();
+
+}
+
+/**
+*	Function: output
+*	Description: outputs to the monitor if the log type is 0 ("Monitor"), outputs to 
+*		the file if the log type is 1 ("File"), or outputs to the file and the 
+*		monitor if the log type is 2 ("Both").
+*/
+void Simulator::output(deque<MetaData> metaData)
+{
+
+	switch (configData.getLogType() + 1)
+	{
+		case 1:
+		
+			outputToMonitor(metaData);
+		
+		break;
+		
+		case 2:
+		
+			outputToFile(metaData);
+		
+		break;
+		
+		case 3:
+		
+			outputToFile(metaData);
+			outputToMonitor(metaData);
+		
+		break;
+		
+		case 4:
+		
+			//binary trace, only the events go to the log file
+			outputToMonitor(metaData);
+			fout.open(configData.getLogPath(), ios::out | ios::binary);
+		
+		break;
+		
+		default:
+		
+			cout << "ERROR: error ocurred during output type selection" << endl;
+			return;
+	}
+
+}
+
+/**
+*	Function - outputToMonitor
+*	Description - Following the template in the guidelines, outputs configuration data 
+*		and the set of meta-data instructions to the monitor. Accounts for the 
+*		possibility that the data could also be logged to the log file.
+*/
+void Simulator::outputToMonitor(deque<MetaData> metaData)
+{
+	
+	string scheduleType;
+	if (configData.getCpuScheduleCode() == 0)
+	{
+		scheduleType = "FIFO";
+	}
+	else if (configData.getCpuScheduleCode() == 1)
+	{
+		scheduleType = "PS";
+	}
+	else if (configData.getCpuScheduleCode() == 2)
+	{
+		scheduleType = "SJF";
+	}
+	else if (configData.getCpuScheduleCode() == 3)
+	{
+		scheduleType = "STR";
+	}
+	else if (configData.getCpuScheduleCode() == 4)
+	{
+		scheduleType = "RR";
+	}
+	else
+	{
+		cout << "ERROR: using incorrect CPU scheduling code" << endl;
+		return;
+	}
+	
+	//Config Output
+	cout << endl;
+	cout << "Configuration File Data" << endl;
+	cout << "Processor Quantum Number = " << configData.getProcessorQuantumNumber()
+		 << endl;
+	cout << "CPU Scheduling Code = " << scheduleType << endl;
+	cout << "Monitor = " << configData.getMonitorTime() << " ms/cycle" << endl;
+	cout << "Processor = " << configData.getProcessorTime() << " ms/cycle" << endl;
+	cout << "Scanner = " << configData.getScannerTime() << " ms/cycle" << endl;
+	cout << "Hard Drive = " << configData.getHardDriveTime() << " ms/cycle" << endl;
+	cout << "Keyboard = " << configData.getKeyboardTime() << " ms/cycle" << endl;
+	cout << "Memory = " << configData.getMemoryTime() << " ms/cycle" << endl;
+	cout << "Projector = " << configData.getProjectorTime() << " ms/cycle" << endl;
+	cout << "System Memory = " << configData.getSystemMemory() << " kbytes" << endl;
+	cout << "Memory Block Size = " << configData.getBlockSize() << " kbytes" << endl;
+	cout << "Projector Quantity = " << configData.getProjQuant() << endl;
+	cout << "Hard Drive Quantity = " << configData.getHddQuant() << endl;
+	cout << "Logged to: ";
+	if (configData.getLogType() == 0)
+	{
+		cout << "monitor" << endl;
+	}
+	else if (configData.getLogType() == 2)
+	{
+		cout << "monitor and " << configData.getLogPath() << endl;
+	}
+	else if (configData.getLogType() == 3)
+	{
+		cout << configData.getLogPath() << " (binary)" << endl;
+	}
+	else
+	{
+		cout << "ERROR: using incorrect output handler" << endl;
+		return;
+	}
+	cout << endl;
+	
+	//Meta-Data Output
+	cout << "Meta-Data Metrics" << endl;
+	for (int i = 0; i < metaData.size(); i++)
+	{
+		if (metaData[i].getCode() != 'S' && metaData[i].getCode() != 'A')
+		{
+			cout << metaData[i].getCode();
+			cout << '{';
+			cout << metaData[i].getDescriptor();
+			cout << '}';
+			cout << metaData[i].getNumOfCycles();
+			cout << " - ";
+			cout << metaData[i].getTotalTime();
+			cout << " ms" << endl;
+		}
+	}
+	cout << endl;
+
+}
+
+/**
+*	Function - outputToFile
+*	Description - Following the template in the guidelines, outputs configuration data 
+*		and the set of meta-data instructions to the file specified in the 
+*		configuration file. Accounts for the possibility that the data could also be 
+*		logged to the monitor.
+*/
+void Simulator::outputToFile(deque<MetaData> metaData)
+{
+
+	string scheduleType;
+	if (configData.getCpuScheduleCode() == 0)
+	{
+		scheduleType = "FIFO";
+	}
+	else if (configData.getCpuScheduleCode() == 1)
+	{
+		scheduleType = "PS";
+	}
+	else if (configData.getCpuScheduleCode() == 2)
+	{
+		scheduleType = "SJF";
+	}
+	else if (configData.getCpuScheduleCode() == 3)
+	{
+		scheduleType = "STR";
+	}
+	else if (configData.getCpuScheduleCode() == 4)
+	{
+		scheduleType = "RR";
+	}
+	else
+	{
+		cout << "ERROR: using incorrect CPU scheduling code" << endl;
+		return;
+	}
+	
+	//ofstream fout;
+	fout.open(configData.getLogPath());
+	
+	//Config Output
+	fout << "Configuration File Data" << endl;
+	fout << "Processor Quantum Number = " << configData.getProcessorQuantumNumber()
+		 << endl;
+	fout << "CPU Scheduling Code = " << scheduleType << endl;
+	fout << "Monitor = " << configData.getMonitorTime() << " ms/cycle" << endl;
+	fout << "Processor = " << configData.getProcessorTime() << " ms/cycle" << endl;
+	fout << "Scanner = " << configData.getScannerTime() << " ms/cycle" << endl;
+	fout << "Hard Drive = " << configData.getHardDriveTime() << " ms/cycle" << endl;
+	fout << "Keyboard = " << configData.getKeyboardTime() << " ms/cycle" << endl;
+	fout << "Memory = " << configData.getMemoryTime() << " ms/cycle" << endl;
+	fout << "Projector = " << configData.getProjectorTime() << " ms/cycle" << endl;
+	fout << "System Memory = " << configData.getSystemMemory() << " kbytes" << endl;
+	fout << "Memory Block Size = " << configData.getBlockSize() << " kbytes" << endl;
+	fout << "Projector Quantity = " << configData.getProjQuant() << endl;
+	fout << "Hard Drive Quantity = " << configData.getHddQuant() << endl;
+	fout << "Logged to: ";
+	if (configData.getLogType() == 1)
+	{
+		fout << configData.getLogPath() << endl;
+	}
+	else if (configData.getLogType() == 2)
+	{
+		fout << "monitor and " << configData.getLogPath() << endl;
+	}
+	else
+	{
+		fout << "ERROR: using incorrect output handler" << endl;
+		return;
+	}
+	fout << endl;
+	
+	//Meta-Data Output
+	fout << "Meta-Data Metrics" << endl;
+	for (int i = 0; i < metaData.size(); i++)
+	{
+		if (metaData[i].getCode() != 'S' && metaData[i].getCode() != 'A')
+		{
+			fout << metaData[i].getCode();
+			fout << '{';
+			fout << metaData[i].getDescriptor();
+			fout << '}';
+			fout << metaData[i].getNumOfCycles();
+			fout << " - ";
+			fout << metaData[i].getTotalTime();
+			fout << " ms" << endl;
+		}
+	}
+	fout << endl;
+	
+	//fout.close();
+}
+
@@ -0,0 +1,201 @@
+/**
+*	File Name: Simulator.h
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Header file for the class Simulator. Owns all of the state of a
+*		single simulation (program queues, PCBs, memory and device locks) so that
+*		several simulations can run side by side in one process
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+#ifndef SIMULATOR_
+#define SIMULATOR_
+
+//library inclusion and directives
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <algorithm>
+#include <pthread.h>
+#include <limits.h>
+#include <time.h>
+#include <atomic>
+#include <random>
+#include "Config.h"
+#include "MetaData.h"
+#include "PCB.h"
+#include "PcbTable.h"
+#include "Logger.h"
+#include "Metrics.h"
+#include "DeviceStats.h"
+#include "OperationLatency.h"
+#include "Profiler.h"
+#include "DiskModel.h"
+#include "DeviceDispatcher.h"
+#include "BufferCache.h"
+#include "InterruptController.h"
+#include "DecisionLog.h"
+#include "EventEngine.h"
+#include "PreciseWaiter.h"
+
+using namespace std;
+
+//summary of a single simulation run, used to report the results of a batch
+struct SimulationSummary
+{
+	string configPath, scheduleType;
+	int processCount, instructionCount;
+	double estimatedTime, simulatedTime, elapsedTime;
+	bool ok;
+};
+
+class Simulator
+{
+
+	//Simulator class public declarations
+	public:
+	
+		Simulator(Config);
+		~Simulator();
+	
+		int run(SimulationSummary&);
+		void setInstructionSet(deque<MetaData>);
+	
+		bool getMetaData(ifstream&, deque<MetaData>&);
+		bool prepProgram(deque<MetaData>);
+		bool runProgram();
+		bool runAnalytic(deque<MetaData>);
+	
+		static clock_t clockTicks();
+		clock_t simulatedTicks();
+		double simulationTime();
+	
+	//Simulator class private declarations
+	private:
+	
+		friend class Benchmark; //times the scheduling functions and allocateMemory()
+	
+		//member function run by a thread created through taskThread()
+		typedef void* (Simulator::*Task)(long, int);
+	
+		//arguments handed to taskThread(), deleted by the thread once it finishes
+		struct ThreadTask
+		{
+			ThreadTask(Simulator* s, Task t, long time, int index)
+				: simulator(s), task(t), taskTime(time), pcbIndex(index) {}
+	
+			Simulator* simulator;
+			Task task;
+			long taskTime;
+			int pcbIndex;
+		};
+	
+		//arguments handed to timer(), deleted by the thread once it finishes
+		struct TimerRequest
+		{
+			PreciseWaiter* waiter;
+			long long microseconds; //of real time
+		};
+	
+		void calculateTotalTimes(deque<MetaData>&);
+		bool checkTimeScale(deque<MetaData>&);
+		bool loadProgram();
+		bool handleProcess(MetaData, PCB&);
+		bool handleQueued(MetaData, PCB&);
+		bool hasInstruction(int);
+		bool systemHandler(PCB&, string);
+		bool applicationHandler(PCB&, string);
+		bool processorHandler(PCB&, int);
+		bool memoryHandler(PCB&, string, int);
+		bool inputHandler(PCB&, string, int, int);
+		bool outputHandler(PCB&, string, int, int);
+		bool cacheRequest(char, int, int&, long&);
+	
+		void prioritySchedule(deque<deque<MetaData>>);
+		void shortestJobFirstSchedule(deque<deque<MetaData>>);
+		void shortestTimeRemainingSchedule(deque<deque<MetaData>> processStorage,
+										   deque<int> indexStorage);
+	
+		int createThread(pthread_t*, void* (*)(void*), void*);
+		void startWorker(Task, long, int);
+		void joinThreads();
+	
+		unsigned int generateMemoryAddress();
+		int allocateMemory(PCB&);
+	
+		static void* timer(void*);
+		void* timerArgument(long);
+		static void* taskThread(void*);
+		static void* loaderThread(void*);
+		static void* rrHandlerThread(void*);
+		static void* samplerThread(void*);
+	
+		void loader();
+		void rrHandler();
+		void sampler();
+		void* processThread(long, int);
+		void* hardDriveInputHandler(long, int);
+		void* keyboardHandler(long, int);
+		void* scannerHandler(long, int);
+		void* hardDriveOutputHandler(long, int);
+		void* monitorHandler(long, int);
+		void* projectorHandler(long, int);
+		void* deviceHandler(long, int, int, bool);
+		void* cacheInputHandler(long, int);
+		void* cacheOutputHandler(long, int);
+		void* cacheHandler(long, int, bool);
+		void signalCompletion(PCB&, int, int, int);
+	
+		void output(deque<MetaData>);
+		void outputToMonitor(deque<MetaData>);
+		void outputToFile(deque<MetaData>);
+	
+		Config configData;
+		deque<MetaData> presetInstructions; //program parsed before the run, if any
+		bool instructionsPreset;
+	
+		ofstream fout;
+		Logger logger;
+		Metrics metrics; //per-process metrics, fed by the logger
+		DeviceStats deviceStats;
+		OperationLatency latencies;
+		DiskModel diskModel; //head and request queue of every hard drive
+		DeviceDispatcher dispatcher; //spreads requests over the units of every device
+		BufferCache bufferCache; //blocks of the hard drives kept in memory
+		InterruptController interrupts; //delivers device completions to the processor
+		PreciseWaiter waiter; //waits of the timer threads
+		Profiler profiler; //real time spent on the simulator's own machinery
+		DecisionLog decisions; //scheduling decisions, recorded or replayed
+		mt19937 random; //seeded with the seed of the decision log
+		int outputType, scheduleType, quantumNumber;
+		double programDuration;
+		double timeScale; //real time per unit of simulated time
+		clock_t programStart; //on the simulated clock
+	
+		deque<deque<MetaData>> program, waitingQueue, readyQueue; //each process
+		deque<int> waitingProcessIndeces, loadedProcessIndeces;
+		PcbTable pcbContainer; //used to store the pcb for each process
+	
+		int blockCount, lastAddress, prevFrontIndex;
+		atomic<int> activeProcesses;
+	
+		bool ableToReorder, interruptOccurred;
+	
+		//the queues are shared by the run loop, the loader and the round robin thread, 
+		//every access to them holds mutexQueues
+		pthread_mutex_t mutexQueues;
+	
+		vector<pthread_t> workerThreads; //processor and device threads of the run
+		pthread_t loadThread;
+		pthread_t rrThread;
+		pthread_t sampleThread;
+		atomic<bool> samplingDone, roundRobinDone;
+	
+};
+
+#endif
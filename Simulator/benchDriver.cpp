@@ -0,0 +1,107 @@
+/**
+*	File Name: benchDriver.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Driver for the micro-benchmarks of the simulator. Runs every
+*		benchmark, writes the results as comma separated values and compares them
+*		against a stored baseline
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+//library inclusion and directives
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdlib.h>
+#include "Benchmark.h"
+
+using namespace std;
+
+/**
+*	Function: main
+*	Description: Runs the benchmarks. The options are --quick to skip the largest
+*		input sizes, --repeats count to time each benchmark count times at each size
+*		(15 by default), --output file to write the results to file, --baseline file
+*		to compare the results against the results stored in file, --tolerance
+*		percent to set how much slower than the baseline a result may be (25 by
+*		default) and --check to fail if a result regressed. Returns 0 if no errors
+*		occurred and, with --check, no result regressed (so make can run it), 1
+*		otherwise.
+*/
+int main(int argc, char *argv[])
+{
+
+	string outputPath, baselinePath;
+	double tolerance = 25;
+	int repeats = Benchmark::REPEATS;
+	bool quick = false, check = false;
+	for (int i = 1; i < argc; i++)
+	{
+		string option = argv[i];
+		if (option == "--quick")
+		{
+			quick = true;
+		}
+		else if (option == "--check")
+		{
+			check = true;
+		}
+		else if (option == "--repeats" && i + 1 < argc)
+		{
+			repeats = atoi(argv[++i]);
+		}
+		else if (option == "--output" && i + 1 < argc)
+		{
+			outputPath = argv[++i];
+		}
+		else if (option == "--baseline" && i + 1 < argc)
+		{
+			baselinePath = argv[++i];
+		}
+		else if (option == "--tolerance" && i + 1 < argc)
+		{
+			tolerance = atof(argv[++i]);
+		}
+		else
+		{
+			cout << "ERROR: usage: " << argv[0] << " [--quick] [--repeats count] "
+				 << "[--output file] [--baseline file] [--tolerance percent] [--check]"
+				 << endl;
+			return 1;
+		}
+	}
+	
+	vector<BenchmarkResult> results, baseline;
+	if (!baselinePath.empty() && !Benchmark::readResults(baselinePath, baseline))
+	{
+		cout << "ERROR: Baseline " << baselinePath << " could not be read" << endl;
+		return 1;
+	}
+	
+	Benchmark benchmark;
+	benchmark.setRepeats(repeats);
+	if (!benchmark.run(results, quick))
+	{
+		return 1;
+	}
+	
+	if (!outputPath.empty() && !Benchmark::writeResults(outputPath, results))
+	{
+		cout << "ERROR: Results could not be written to " << outputPath << endl;
+		return 1;
+	}
+	
+	//results whose runs spread more than the tolerance are never counted
+	int regressions = Benchmark::compareResults(results, baseline, tolerance, cout);
+	if (regressions > 0)
+	{
+		cout << regressions << " result(s) more than " << tolerance
+			 << "% slower than the baseline" << endl;
+		return check ? 1 : 0;
+	}
+	
+	return 0;
+
+}
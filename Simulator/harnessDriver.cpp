@@ -0,0 +1,329 @@
+/**
+*	File Name: harnessDriver.cpp
+*	Editors: Alex Kastanek
+*	Project: CS446 Operating Systems Simulation
+*	File Description: Driver for the scheduler comparison harness. Runs every
+*		scheduling policy over a corpus of workloads on the virtual clock of the
+*		EventEngine and prints throughput, turnaround, context switches and
+*		utilization side by side
+*	Version: 01
+*	Last Date Revised: 2/7/18
+*/
+
+//library inclusion and directives
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <deque>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Config.h"
+#include "MetaData.h"
+#include "Simulator.h"
+#include "Metrics.h"
+#include "EventEngine.h"
+
+using namespace std;
+
+//function headers
+
+bool runWorkload(string, string, string, long, bool, ostream&, ostream*, ostream*,
+				 istream*);
+
+/**
+*	Function: main
+*	Description: Reads the corpus file given as the first argument, where each line
+*		names a configuration file and the meta-data file to run with it, optionally
+*		followed by "key: value" settings separated by "; " that override the
+*		configuration (lines starting with '#' are comments), and compares every
+*		scheduling policy on each of them. With --csv file, every row is also written
+*		to file as comma separated values. With --checkpoint-at msec, every run is
+*		checkpointed at that virtual time and finished from the checkpoint by a new
+*		engine, which gives the same results as an uninterrupted run. With
+*		--save-checkpoint file as well, the checkpoints of every run are also written 
+*		to file, in the order of the runs. With --restore-checkpoint file, every run 
+*		is instead finished from the checkpoint read from file, which has to have 
+*		been saved from the same corpus, so a warm-up prefix only has to be run once. 
+*		With --no-fast-path, runs the engine could work out in closed form are 
+*		simulated anyway, to compare the two. Returns 0 if no errors occurred (so make 
+*		can run it), 1 otherwise.
+*/
+int main(int argc, char *argv[])
+{
+
+	string corpusPath, csvPath, savePath, restorePath;
+	long checkpointTime = -1;
+	bool fastPath = true;
+	for (int i = 1; i < argc; i++)
+	{
+		if (string(argv[i]) == "--csv" && i + 1 < argc)
+		{
+			csvPath = argv[++i];
+		}
+		else if (string(argv[i]) == "--checkpoint-at" && i + 1 < argc)
+		{
+			checkpointTime = atol(argv[++i]);
+		}
+		else if (string(argv[i]) == "--save-checkpoint" && i + 1 < argc)
+		{
+			savePath = argv[++i];
+		}
+		else if (string(argv[i]) == "--restore-checkpoint" && i + 1 < argc)
+		{
+			restorePath = argv[++i];
+		}
+		else if (string(argv[i]) == "--no-fast-path")
+		{
+			fastPath = false;
+		}
+		else if (corpusPath.empty())
+		{
+			corpusPath = argv[i];
+		}
+		else
+		{
+			corpusPath.clear();
+			break;
+		}
+	}
+	if (corpusPath.empty() || (!savePath.empty() && checkpointTime < 0) ||
+		(!restorePath.empty() && (checkpointTime >= 0 || !savePath.empty())))
+	{
+		cout << "ERROR: usage: " << argv[0] << " [--csv file] [--checkpoint-at msec "
+			 << "[--save-checkpoint file] | --restore-checkpoint file] "
+			 << "[--no-fast-path] corpusFile" << endl;
+		return 1;
+	}
+	
+	ifstream fin(corpusPath.c_str());
+	if (!fin.is_open())
+	{
+		cout << "ERROR: Corpus " << corpusPath << " could not be opened" << endl;
+		return 1;
+	}
+	
+	ofstream csv;
+	if (!csvPath.empty())
+	{
+		csv.open(csvPath.c_str());
+		if (!csv.is_open())
+		{
+			cout << "ERROR: " << csvPath << " could not be written" << endl;
+			return 1;
+		}
+		csv << "config,workload,setting,policy,processes,makespan_ms,throughput,"
+			<< "mean_turnaround_ms,p99_turnaround_ms,mean_response_ms,"
+			<< "context_switches,preemptions,cpu,hard_drive,keyboard,scanner,"
+			<< "monitor,projector" << endl;
+	}
+	
+	ofstream saved;
+	ifstream restored;
+	if (!savePath.empty())
+	{
+		saved.open(savePath.c_str(), ios::out | ios::binary);
+		if (!saved.is_open())
+		{
+			cout << "ERROR: " << savePath << " could not be written" << endl;
+			return 1;
+		}
+	}
+	if (!restorePath.empty())
+	{
+		restored.open(restorePath.c_str(), ios::in | ios::binary);
+		if (!restored.is_open())
+		{
+			cout << "ERROR: Checkpoint " << restorePath << " could not be opened"
+				 << endl;
+			return 1;
+		}
+	}
+	
+	string line;
+	bool okToContinue = true;
+	while (okToContinue && getline(fin, line))
+	{
+		string configPath, metaDataPath, setting;
+		stringstream fields(line);
+		fields >> configPath >> metaDataPath >> ws;
+		getline(fields, setting);
+		if (configPath.empty() || configPath[0] == '#')
+		{
+			continue;
+		}
+		okToContinue = runWorkload(configPath, metaDataPath, setting, checkpointTime,
+								   fastPath, cout, csv.is_open() ? &csv : NULL,
+								   saved.is_open() ? &saved : NULL,
+								   restored.is_open() ? &restored : NULL);
+	}
+	fin.close();
+	
+	return okToContinue ? 0 : 1;
+
+}
+
+/**
+*	Function: runWorkload
+*	Description: Runs the meta-data file at metaDataPath with the configuration at
+*		configPath, changed by the settings in setting, under every scheduling 
+*		policy the configuration knows and writes a table of the results to out, and 
+*		a row per policy to csv if it is not NULL. If checkpointTime is not negative,
+*		each run is checkpointed at that virtual time (msec) and finished by another
+*		engine restored from the checkpoint, which is also written to saved if it is
+*		not NULL. If restored is not NULL, each run is finished from the next 
+*		checkpoint read from it instead. Otherwise runs the engine can work out in
+*		closed form are, unless fastPath is false. Returns false if either file could
+*		not be read, the setting is invalid or a checkpoint failed.
+*/
+bool runWorkload(string configPath, string metaDataPath, string setting,
+				 long checkpointTime, bool fastPath, ostream& out, ostream* csv,
+				 ostream* saved, istream* restored)
+{
+
+	Config configData;
+	ifstream fin(configPath.c_str());
+	if (!fin.is_open())
+	{
+		cout << "ERROR: Config file " << configPath << " could not be opened" << endl;
+		return 0;
+	}
+	configData.getConfigData(fin);
+	fin.close();
+	configData.setFilePath(metaDataPath);
+	for (size_t begin = 0; begin < setting.size(); )
+	{
+		size_t end = setting.find("; ", begin);
+		string current = setting.substr(begin, end == string::npos ? string::npos :
+										end - begin);
+		size_t colon = current.find(": ");
+		string key = current.substr(0, colon);
+		if (colon == string::npos ||
+			!configData.applySetting(key, current.substr(colon + 2)))
+		{
+			cout << "ERROR: Invalid setting \"" << current << "\"" << endl;
+			return 0;
+		}
+		begin = end == string::npos ? setting.size() : end + 2;
+	}
+	
+	//total times depend on the device times only, not on the policy
+	deque<MetaData> instructionSet;
+	Simulator simulator(configData);
+	fin.open(metaDataPath.c_str());
+	if (!fin.is_open() || !simulator.getMetaData(fin, instructionSet))
+	{
+		cout << "ERROR: Meta-data file " << metaDataPath << " could not be read"
+			 << endl;
+		return 0;
+	}
+	fin.close();
+	
+	char row[200];
+	out << endl << "Workload " << metaDataPath << " with " << configPath;
+	if (!setting.empty())
+	{
+		out << " (" << setting << ")";
+	}
+	out << endl;
+	snprintf(row, sizeof(row), "%-6s %9s %10s %9s %9s %9s %8s %6s %6s %6s %6s %6s "
+			 "%6s\n", "policy", "makespan", "throughput", "mean tat", "p99 tat",
+			 "mean rsp", "switches", "cpu", "hdd", "kbd", "scan", "mon", "proj");
+	out << row;
+	
+	//every scheduling code the configuration can name, so new policies are included
+	for (int code = 0; true; code++)
+	{
+		configData.setCpuScheduleCode(code);
+		string policy = configData.getCpuScheduleName();
+		if (policy == "UNKNOWN")
+		{
+			break;
+		}
+	
+		EventEngine engine(configData);
+		Metrics metrics;
+		EngineResult result;
+		engine.addSink(&metrics);
+		metrics.reset(engine.load(instructionSet));
+		engine.setFastPath(fastPath);
+		if (restored != NULL)
+		{
+			//the metrics of the prefix are saved after the engine
+			if (!engine.restoreCheckpoint(*restored))
+			{
+				return 0;
+			}
+			CheckpointReader prefix(*restored);
+			if (!metrics.restore(prefix))
+			{
+				cout << "ERROR: Checkpoint could not be read" << endl;
+				return 0;
+			}
+			engine.finish(result);
+		}
+		else if (checkpointTime >= 0)
+		{
+			//the sink carries on from the prefix, as it would in an uninterrupted run
+			stringstream checkpoint;
+			EventEngine forked(configData);
+			forked.addSink(&metrics);
+			if (!engine.start())
+			{
+				return 0;
+			}
+			engine.runUntil(checkpointTime);
+			if (!engine.saveCheckpoint(checkpoint) ||
+				!forked.restoreCheckpoint(checkpoint))
+			{
+				return 0;
+			}
+			if (saved != NULL)
+			{
+				if (!engine.saveCheckpoint(*saved))
+				{
+					return 0;
+				}
+				CheckpointWriter prefix(*saved);
+				metrics.save(prefix);
+			}
+			forked.finish(result);
+		}
+		else if (!engine.run(result))
+		{
+			return 0;
+		}
+		MetricStats turnaround = metrics.getTurnaroundStats();
+		MetricStats response = metrics.getResponseStats();
+		double* utilization = result.deviceUtilization;
+	
+		snprintf(row, sizeof(row), "%-6s %7ldms %8.2f/s %7.0fms %7.0fms %7.0fms %8d "
+				 "%5.1f%% %5.1f%% %5.1f%% %5.1f%% %5.1f%% %5.1f%%\n", policy.c_str(),
+				 result.makespan, result.throughput, turnaround.mean * 1000,
+				 turnaround.p99 * 1000, response.mean * 1000, result.contextSwitches,
+				 100 * result.cpuUtilization, 100 * utilization[DEVICE_HARD_DRIVE],
+				 100 * utilization[DEVICE_KEYBOARD], 100 * utilization[DEVICE_SCANNER],
+				 100 * utilization[DEVICE_MONITOR],
+				 100 * utilization[DEVICE_PROJECTOR]);
+		out << row;
+	
+		if (csv != NULL)
+		{
+			snprintf(row, sizeof(row), "%s,%s,\"%s\",%s,%d,%ld,%.4f,%.3f,%.3f,%.3f,%d,"
+					 "%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n", configPath.c_str(),
+					 metaDataPath.c_str(), setting.c_str(), policy.c_str(),
+					 result.processCount,
+					 result.makespan, result.throughput, turnaround.mean * 1000,
+					 turnaround.p99 * 1000, response.mean * 1000,
+					 result.contextSwitches, result.preemptions, result.cpuUtilization,
+					 utilization[DEVICE_HARD_DRIVE], utilization[DEVICE_KEYBOARD],
+					 utilization[DEVICE_SCANNER], utilization[DEVICE_MONITOR],
+					 utilization[DEVICE_PROJECTOR]);
+			*csv << row;
+		}
+	}
+	
+	return 1;
+
+}